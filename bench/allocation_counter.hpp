@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Counts heap allocations per thread by replacing the global operator new,
+// so it is included by the one source file of a benchmark only.
+namespace bench
+{
+
+inline size_t &thread_allocations()
+{
+    static thread_local size_t count = 0;
+    return count;
+}
+
+// allocations of the calling thread since it was created
+class AllocationCount
+{
+  public:
+    AllocationCount() : m_start(thread_allocations())
+    {
+    }
+
+    size_t count() const
+    {
+        return thread_allocations() - m_start;
+    }
+
+  private:
+    size_t m_start;
+};
+
+} // namespace bench
+
+// noinline keeps GCC from pairing the inlined malloc and free with the
+// new and delete of callers and warning about a mismatch
+__attribute__((noinline)) void *operator new(std::size_t size)
+{
+    bench::thread_allocations()++;
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    operator delete(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
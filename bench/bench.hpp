@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+// Helpers shared by the micro-benchmarks in bench/. Each benchmark is a
+// program of its own that prints one line per measurement.
+namespace bench
+{
+
+// keeps the compiler from dropping a result nobody reads
+template <typename T>
+void keep(const T &value)
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// nanoseconds of a single run of fn
+template <typename Function>
+double elapsed_ns(Function &&fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count();
+}
+
+// mean nanoseconds per run of fn, after one warm-up run
+template <typename Function>
+double time_ns(size_t runs, Function &&fn)
+{
+    fn();
+    return elapsed_ns([&] {
+        for (size_t i = 0; i < runs; i++)
+            fn();
+    }) / static_cast<double>(runs);
+}
+
+inline void report(const char *name, double ns)
+{
+    std::printf("%-48s %12.1f ns\n", name, ns);
+}
+
+// bytes is what one run processes
+inline void report(const char *name, double ns, size_t bytes)
+{
+    std::printf("%-48s %12.1f ns %10.1f MB/s\n", name, ns, static_cast<double>(bytes) * 1000.0 / ns);
+}
+
+} // namespace bench
@@ -0,0 +1,111 @@
+// Throughput of the hex kernels in hex.hpp against the code they replaced:
+// sscanf("%2X") per byte for decoding and std::ostringstream for packing.
+
+#include <cstdio>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench/bench.hpp"
+#include "hex.hpp"
+#include "utils.hpp"
+
+namespace
+{
+
+// the former hex2bin
+void legacy_decode(const char *hex, size_t size, unsigned char *out)
+{
+    uint32_t byte = 0;
+    for (size_t i = 0; i < size / 2; i++)
+    {
+        sscanf(hex + 2 * i, "%2X", &byte);
+        out[i] = static_cast<unsigned char>(byte);
+    }
+}
+
+// the former pack_message
+std::string legacy_pack(int type, size_t length, const std::vector<uint8_t> &msg)
+{
+    std::ostringstream stream;
+    stream << std::setfill('0') << std::setw(4) << std::hex << type;
+    stream << std::setw(8) << std::hex << length;
+    for (size_t i = 0; i < length; i++)
+        stream << std::setw(2) << std::hex << static_cast<uint32_t>(msg[i]);
+    return stream.str();
+}
+
+struct Kernel
+{
+    const char *name;
+    hex::EncodeFunction encode;
+    hex::DecodeFunction decode;
+    bool supported;
+};
+
+std::vector<Kernel> kernels()
+{
+    std::vector<Kernel> kernels = {{"scalar", hex::encode_scalar, hex::decode_scalar, true}};
+#ifdef HEX_X86_KERNELS
+    __builtin_cpu_init();
+    kernels.push_back({"sse2", hex::encode_sse2, hex::decode_sse2, __builtin_cpu_supports("sse2") != 0});
+    kernels.push_back({"avx2", hex::encode_avx2, hex::decode_avx2, __builtin_cpu_supports("avx2") != 0});
+#endif
+    return kernels;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(1);
+    const size_t sizes[] = {64, 1024, 64 * 1024};
+
+    for (auto size : sizes)
+    {
+        std::vector<uint8_t> bytes(size);
+        for (auto &byte : bytes)
+            byte = static_cast<uint8_t>(rng());
+        std::string digits(2 * size, '0');
+        hex::encode_scalar(bytes.data(), size, &digits[0]);
+        std::vector<uint8_t> decoded(size);
+        auto runs = 64 * 1024 * 1024 / size / 16;
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "decode %zu B legacy sscanf", size);
+        bench::report(name, bench::time_ns(runs / 16 + 1, [&] {
+            legacy_decode(digits.data(), digits.size(), decoded.data());
+            bench::keep(decoded);
+        }), size);
+
+        for (const auto &kernel : kernels())
+        {
+            if (!kernel.supported)
+                continue;
+            std::snprintf(name, sizeof(name), "decode %zu B %s", size, kernel.name);
+            bench::report(name, bench::time_ns(runs, [&] {
+                kernel.decode(digits.data(), digits.size(), decoded.data());
+                bench::keep(decoded);
+            }), size);
+        }
+
+        for (const auto &kernel : kernels())
+        {
+            if (!kernel.supported)
+                continue;
+            std::snprintf(name, sizeof(name), "encode %zu B %s", size, kernel.name);
+            bench::report(name, bench::time_ns(runs, [&] {
+                kernel.encode(bytes.data(), size, &digits[0]);
+                bench::keep(digits);
+            }), size);
+        }
+
+        std::snprintf(name, sizeof(name), "pack %zu B legacy ostringstream", size);
+        bench::report(name, bench::time_ns(runs / 16 + 1, [&] { bench::keep(legacy_pack(1, size, bytes)); }), size);
+
+        std::snprintf(name, sizeof(name), "pack %zu B pack_message", size);
+        bench::report(name, bench::time_ns(runs, [&] { bench::keep(pack_message(1, size, bytes)); }), size);
+    }
+    return 0;
+}
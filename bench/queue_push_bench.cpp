@@ -0,0 +1,94 @@
+// Allocations and time per WorkingQueue::push of a task shaped like the ones
+// BaseDeviceManager queues, against the std::function tuple items the queue
+// used to copy into a std::list.
+
+#include <functional>
+#include <list>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "bench/allocation_counter.hpp"
+#include "bench/bench.hpp"
+#include "queue/working_queue.h"
+
+namespace
+{
+
+const size_t PUSHES = 1000;
+
+// the hex frame of a call, moved into the task like BaseDeviceManager does
+std::vector<std::string> frames()
+{
+    return std::vector<std::string>(PUSHES, std::string(200, 'a'));
+}
+
+template <typename Queue>
+void push_all(Queue &queue, std::vector<std::string> &messages)
+{
+    for (size_t i = 0; i < PUSHES; i++)
+    {
+        queue.push(i, [&queue, message = std::move(messages[i])](const size_t &id) mutable {
+            bench::keep(message);
+            return id != 0;
+        });
+    }
+}
+
+template <typename Queue>
+void measure(const char *name)
+{
+    Queue queue;
+    // nothing runs, the items stay queued
+    queue.lockPop();
+
+    // the first round warms up whatever the storage keeps between pushes
+    double allocations = 0;
+    double ns = 0;
+    for (int round = 0; round < 2; round++)
+    {
+        auto messages = frames();
+        bench::AllocationCount count;
+        ns = bench::elapsed_ns([&] { push_all(queue, messages); }) / PUSHES;
+        allocations = static_cast<double>(count.count()) / PUSHES;
+        queue.clear();
+    }
+    std::printf("%-48s %12.1f ns %10.2f allocations\n", name, ns, allocations);
+}
+
+// the former InQueueItem, copied by Queue::push(const T &)
+void measure_legacy()
+{
+    using Item = std::tuple<size_t, std::function<bool(const size_t &)>, std::function<void(const size_t &, const bool &)>>;
+    std::list<Item> queue;
+
+    double allocations = 0;
+    double ns = 0;
+    for (int round = 0; round < 2; round++)
+    {
+        auto messages = frames();
+        bench::AllocationCount count;
+        ns = bench::elapsed_ns([&] {
+            for (size_t i = 0; i < PUSHES; i++)
+            {
+                Item item(i, [&queue, message = std::move(messages[i])](const size_t &id) {
+                    bench::keep(message);
+                    return id != 0;
+                }, nullptr);
+                queue.push_back(item);
+            }
+        }) / PUSHES;
+        allocations = static_cast<double>(count.count()) / PUSHES;
+        queue.clear();
+    }
+    std::printf("%-48s %12.1f ns %10.2f allocations\n", "push legacy std::function tuple", ns, allocations);
+}
+
+} // namespace
+
+int main()
+{
+    measure<WorkingQueue<bool, size_t>>("push WorkingQueue<Queue>");
+    measure<WorkingQueue<bool, size_t, MpscQueue>>("push WorkingQueue<MpscQueue>");
+    measure_legacy();
+    return 0;
+}
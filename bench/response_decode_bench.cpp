@@ -0,0 +1,123 @@
+// Time and heap allocations from the bridge's hex response to a parsed
+// message, fed to the decoders in curl-sized chunks.
+//
+// The former path kept the hex in a std::string, tried to parse it as a
+// JSON error, decoded it into a temporary byte array, copied that into
+// Call::msg and parsed a heap message: three copies of the body. Now the
+// hex is decoded straight into Call::msg as it arrives and parsed on a
+// MessageArena, or into the hw_definitions struct without protobuf. Its hex
+// decoding uses hex.hpp in both, to show the copies alone.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "bench/allocation_counter.hpp"
+#include "bench/bench.hpp"
+#include "call_decoder.hpp"
+#include "message_arena.hpp"
+#include "messages-common.pb.h"
+#include "messages-hds.pb.h"
+#include "wire/hds_struct_decoder.hpp"
+
+using namespace hw::trezor::messages;
+
+namespace
+{
+
+// CURL_MAX_WRITE_SIZE, the most curl hands to a write callback at once
+const size_t CHUNK_SIZE = 16 * 1024;
+
+template <typename Receive>
+void receive_chunks(const std::string &hex, Receive receive)
+{
+    for (size_t offset = 0; offset < hex.size(); offset += CHUNK_SIZE)
+        receive(&hex[offset], std::min(CHUNK_SIZE, hex.size() - offset));
+}
+
+template <typename T>
+T legacy_decode(const std::string &hex)
+{
+    std::string raw;
+    receive_chunks(hex, [&](const char *data, size_t size) { raw.append(data, size); });
+    try
+    {
+        bench::keep(nlohmann::json::parse(raw.c_str(), raw.c_str() + raw.size()));
+    }
+    catch (const nlohmann::detail::exception &)
+    {
+    }
+
+    std::unique_ptr<unsigned char[]> bytes(new unsigned char[raw.length() / 2]);
+    hex::decode(raw.c_str(), raw.length(), bytes.get());
+    Call call;
+    copy_reversed(bytes.get(), &call.type);
+    copy_reversed(bytes.get() + sizeof(call.type), &call.length);
+    auto body = bytes.get() + sizeof(call.type) + sizeof(call.length);
+    std::copy_n(body, call.length, std::back_inserter(call.msg));
+
+    T message;
+    message.ParseFromArray(call.msg.data(), static_cast<int>(call.length));
+    return message;
+}
+
+Call decode_call(const std::string &hex)
+{
+    CallDecoder decoder;
+    receive_chunks(hex, [&](const char *data, size_t size) { decoder.append(data, size); });
+    return decoder.finish();
+}
+
+template <typename Function>
+void measure(const char *name, Function &&decode)
+{
+    const size_t runs = 20000;
+    decode();
+    bench::AllocationCount count;
+    auto ns = bench::elapsed_ns([&] {
+        for (size_t i = 0; i < runs; i++)
+            decode();
+    });
+    std::printf("%-48s %12.1f ns %10.2f allocations\n", name, ns / runs, static_cast<double>(count.count()) / runs);
+}
+
+template <typename T>
+void measure_message(const char *name, const T &response)
+{
+    auto hex = pack_message(response);
+    char label[64];
+
+    std::snprintf(label, sizeof(label), "%s legacy", name);
+    measure(label, [&] { bench::keep(legacy_decode<T>(hex)); });
+
+    std::snprintf(label, sizeof(label), "%s CallDecoder + arena", name);
+    measure(label, [&] {
+        auto call = decode_call(hex);
+        MessageArena arena;
+        auto message = arena.create<T>();
+        call.parse_into(*message);
+        bench::keep(*message);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    hds::HdsECCPoint point;
+    point.set_x(std::string(32, '\x5a'));
+    point.set_y(true);
+    measure_message("HdsECCPoint", point);
+
+    auto hex = pack_message(point);
+    measure("HdsECCPoint CallDecoder + StructDecoder", [&] {
+        auto call = decode_call(hex);
+        wire::StructDecoder<hds::HdsECCPoint>::Struct value;
+        bench::keep(wire::StructDecoder<hds::HdsECCPoint>::decode(call.msg.data(), call.length, value));
+        bench::keep(value);
+    });
+
+    common::Success success;
+    success.set_message(std::string(64 * 1024, 'a'));
+    measure_message("Success 64 KiB", success);
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Startup costs of a short-lived process, which CLI helpers pay on every run.
+//
+// Pre-main is the CPU time used before main, mostly protobuf registering the
+// linked .pb.cc files and the dynamic loader. The libcurl lines compare a
+// full curl_global_init/cleanup cycle, what every process pays once, with
+// the first Client, which goes through CurlGlobal, and the ones after it,
+// which only create their easy handle. With a bridge on 127.0.0.1:21325 it
+// also times the first enumerate() and the first response, the Features
+// the first device answers Initialize with.
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <curl/curl.h>
+#include "bench/bench.hpp"
+#include "client.hpp"
+#include "utils.hpp"
+#include "messages-management.pb.h"
+
+namespace
+{
+
+// nanoseconds since start
+double since(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+void first_response()
+{
+    auto start = std::chrono::steady_clock::now();
+    Client client;
+    auto devices = client.enumerate();
+    bench::report("first enumerate()", since(start));
+    if (devices.empty())
+    {
+        std::printf("no bridge or device, first response skipped\n");
+        return;
+    }
+
+    auto session = client.acquire(devices[0].path, devices[0].session).session;
+    auto features = client.call(session, pack_message(hw::trezor::messages::management::Initialize()));
+    bench::report("first response, Features", since(start));
+    if (features.type != message_traits<hw::trezor::messages::management::Features>::id)
+        std::printf("the device answered with message type %u\n", static_cast<unsigned>(features.type));
+    client.release(session);
+}
+
+} // namespace
+
+int main()
+{
+    bench::report("pre-main CPU", static_cast<double>(std::clock()) * 1e9 / CLOCKS_PER_SEC);
+
+    // runs before CurlGlobal, which keeps libcurl set up until exit
+    bench::report("curl_global_init/cleanup + easy handle", bench::time_ns(100, [] {
+                      curl_global_init(CURL_GLOBAL_DEFAULT);
+                      CURL *curl = curl_easy_init();
+                      bench::keep(curl);
+                      curl_easy_cleanup(curl);
+                      curl_global_cleanup();
+                  }));
+
+    bench::report("first Client", bench::elapsed_ns([] { Client client; }));
+    bench::report("Client, created and destroyed", bench::time_ns(1000, [] { Client client; }));
+
+    hw::trezor::messages::management::Initialize initialize;
+    bench::report("first pack_message", bench::elapsed_ns([&] { bench::keep(pack_message(initialize)); }));
+    bench::report("pack_message", bench::time_ns(1000, [&] { bench::keep(pack_message(initialize)); }));
+
+    first_response();
+    return 0;
+}
@@ -5,13 +5,11 @@
 #include "utils.hpp"
 #include "models/models.hpp"
 
-#include <google/protobuf/message.h>
 using namespace google::protobuf;
 
 #include "messages-management.pb.h"
 #include "messages-common.pb.h"
 #include "messages-hds.pb.h"
-#include "messages.pb.h"
 using namespace hw::trezor::messages::management;
 
 // using this namespace conflicts with our code, so I commented it
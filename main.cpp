@@ -1,19 +1,33 @@
 #include <iostream>
 #include <string>
 #include "client.hpp"
+#include "udp_client.hpp"
 #include "queue/working_queue.h"
 #include "device_manager.hpp"
 
 #include "debug.hpp"
 #include "hw_definitions.hpp"
 
-int main()
+int main(int argc, char *argv[])
 {
-    Client client;
+    // --emulator talks to a local Trezor emulator directly instead of trezord,
+    // --async drives all bridge requests from one curl_multi thread and runs
+    // the devices on a shared thread pool
+    std::string mode = argc > 1 ? argv[1] : "";
+    auto make_transport = [mode]() -> std::unique_ptr<Transport> {
+        if (mode == "--emulator")
+            return std::make_unique<UdpClient>();
+        if (mode == "--async")
+            return std::make_unique<Client>(Client::Mode::Async);
+        return std::make_unique<Client>();
+    };
+
+    auto pool = mode == "--async" ? std::make_shared<ThreadPool>() : nullptr;
+    auto client = make_transport();
     std::vector<std::unique_ptr<DeviceManager>> trezors;
-    std::vector<std::unique_ptr<std::atomic_flag>> is_alive_flags;
+    std::vector<std::future<hw::trezor::messages::hds::HdsNumSlots>> last_calls;
 
-    auto enumerates = client.enumerate();
+    auto enumerates = client->enumerate();
 
     if (enumerates.size() == 0)
     {
@@ -21,40 +35,27 @@ int main()
         return 1;
     }
 
-    auto clear_flag = [&](size_t queue_size, size_t idx) {
-        if (queue_size == 0)
-            is_alive_flags.at(idx)->clear();
-    };
-
     for (auto enumerate : enumerates)
     {
-        trezors.push_back(std::unique_ptr<DeviceManager>(new DeviceManager()));
-        {
-            auto af = std::make_unique<std::atomic_flag>();
-            af->test_and_set();
-            is_alive_flags.emplace_back(move(af));
-        }
-        auto is_alive_idx = is_alive_flags.size() - 1;
+        trezors.push_back(std::unique_ptr<DeviceManager>(new DeviceManager(make_transport(), pool)));
         auto& trezor = trezors.back();
 
-        if (enumerate.session != "null")
+        if (enumerate.session)
         {
-            client.release(enumerate.session);
-            enumerate.session = "null";
+            client->release(enumerate.session);
+            enumerate.session = SessionHandle();
         }
 
-        trezor->callback_Failure([&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+        trezor->on<Failure>([&](const Failure &msg, SessionHandle session, size_t queue_size) {
             std::cout << "SESSION: " << session << std::endl;
-            std::cout << "FAIL REASON: " << child_cast<Message, Failure>(msg).message() << std::endl;
+            std::cout << "FAIL REASON: " << msg.message() << std::endl;
             std::cout << std::endl;
-            clear_flag(queue_size, is_alive_idx);
         });
 
-        trezor->callback_Success([&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+        trezor->on<Success>([&](const Success &msg, SessionHandle session, size_t queue_size) {
             std::cout << "SESSION: " << session << std::endl;
-            std::cout << "SUCCESS: " << child_cast<Message, Success>(msg).message() << std::endl;
+            std::cout << "SUCCESS: " << msg.message() << std::endl;
             std::cout << std::endl;
-            clear_flag(queue_size, is_alive_idx);
         });
 
         try
@@ -62,36 +63,32 @@ int main()
             using namespace hw::trezor::messages::hds;
             
             trezor->init(enumerate);
-            trezor->call_Ping("hello hds", true, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+            trezor->call_Ping("hello hds", true, [&](const Success &msg, SessionHandle session, size_t queue_size) {
                 std::cout << "SESSION: " << session << std::endl;
-                std::cout << "PONG: " << child_cast<Message, Success>(msg).message() << std::endl;
+                std::cout << "PONG: " << msg.message() << std::endl;
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
-            trezor->call_HdsGetOwnerKey(true, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+            trezor->call_HdsGetOwnerKey(true, [&](const HdsCrypto_UintBig &key, SessionHandle session, size_t queue_size) {
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HDS OWNER KEY: ";
-                print_bin(reinterpret_cast<const uint8_t *>(child_cast<Message, HdsOwnerKey>(msg).key().c_str()), 32);
+                print_bin(key.m_pVal, 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
-            trezor->call_HdsGenerateNonce(1, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+            trezor->call_HdsGenerateNonce(1, [&](const HdsCrypto_CompactPoint &pub, SessionHandle session, size_t queue_size) {
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HDS NONCE IN SLOT 1: " << std::endl;
                 std::cout << "pub_x: ";
-                print_bin(reinterpret_cast<const uint8_t *>(child_cast<Message, HdsECCPoint>(msg).x().c_str()), 32);
-                std::cout << "pub_y: " << child_cast<Message, HdsECCPoint>(msg).y() << std::endl;
+                print_bin(pub.m_X.m_pVal, 32);
+                std::cout << "pub_y: " << static_cast<int>(pub.m_Y) << std::endl;
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
-            trezor->call_HdsGetNoncePublic(1, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
+            trezor->call_HdsGetNoncePublic(1, [&](const HdsCrypto_CompactPoint &pub, SessionHandle session, size_t queue_size) {
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HDS PUBLIC KEY OF NONCE IN SLOT 1:" << std::endl;
                 std::cout << "pub_x: ";
-                print_bin(reinterpret_cast<const uint8_t *>(child_cast<Message, HdsECCPoint>(msg).x().c_str()), 32);
-                std::cout << "pub_y: " << child_cast<Message, HdsECCPoint>(msg).y() << std::endl;
+                print_bin(pub.m_X.m_pVal, 32);
+                std::cout << "pub_y: " << static_cast<int>(pub.m_Y) << std::endl;
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
             uint8_t test_bytes[32] = {0x87, 0xdc, 0x3d, 0x21, 0x41, 0x74, 0x82, 0x0e, 0x11, 0x54, 0xb4, 0x9b, 0xc6, 0xcd, 0xb2, 0xab, 0xd4, 0x5e, 0xe9, 0x58, 0x17, 0x05, 0x5d, 0x25, 0x5a, 0xa3, 0x58, 0x31, 0xb7, 0x0d, 0x32, 0x66};
@@ -125,34 +122,31 @@ int main()
             txSenderParams.m_iSlot = 2;
             memset(txSenderParams.m_UserAgreement.m_pVal, 0, 32);
 
-            trezor->call_HdsSignTransactionSend(txCommon, txMutualInfo, txSenderParams, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsSignTransactionSend>(msg).tx_common().offset_sk().c_str());
+            trezor->call_HdsSignTransactionSend(txCommon, txMutualInfo, txSenderParams, [&](const HdsSignTransactionSend &msg, SessionHandle session, size_t queue_size) {
+                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(msg.tx_common().offset_sk().c_str());
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HdsSignTransactionSend" << std::endl;
                 std::cout << "HDS TX offset_sk: ";
                 print_bin(reinterpret_cast<const uint8_t *>(offset_sk), 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
-            trezor->call_HdsSignTransactionReceive(txCommon, txMutualInfo, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsSignTransactionReceive>(msg).tx_common().offset_sk().c_str());
+            trezor->call_HdsSignTransactionReceive(txCommon, txMutualInfo, [&](const HdsSignTransactionReceive &msg, SessionHandle session, size_t queue_size) {
+                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(msg.tx_common().offset_sk().c_str());
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HdsSignTransactionReceive" << std::endl;
                 std::cout << "HDS TX offset_sk: ";
                 print_bin(reinterpret_cast<const uint8_t *>(offset_sk), 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
-            trezor->call_HdsSignTransactionSplit(txCommon, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsSignTransactionSplit>(msg).tx_common().offset_sk().c_str());
+            trezor->call_HdsSignTransactionSplit(txCommon, [&](const HdsSignTransactionSplit &msg, SessionHandle session, size_t queue_size) {
+                const uint8_t *offset_sk = reinterpret_cast<const uint8_t *>(msg.tx_common().offset_sk().c_str());
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HdsSignTransactionSplit" << std::endl;
                 std::cout << "HDS TX offset_sk: ";
                 print_bin(reinterpret_cast<const uint8_t *>(offset_sk), 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
             HdsCrypto_CoinID cid = {1, 111, 16777216, 23110, 0};
@@ -163,10 +157,10 @@ int main()
             pt0.m_Y = 1;
             pt1.m_Y = 1;
 
-            trezor->call_HdsGenerateRangeproof(&cid, &pt0, &pt1, nullptr, nullptr, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                bool is_successful = child_cast<Message, HdsRangeproofData>(msg).is_successful();
-                const uint8_t *pt0_x = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsRangeproofData>(msg).pt0().x().c_str());
-                const uint8_t *pt1_x = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsRangeproofData>(msg).pt1().x().c_str());
+            trezor->call_HdsGenerateRangeproof(&cid, &pt0, &pt1, nullptr, nullptr, [&](const HdsCrypto_RangeproofData &rangeproof, SessionHandle session, size_t queue_size) {
+                bool is_successful = rangeproof.m_IsSuccessful;
+                const uint8_t *pt0_x = rangeproof.m_T1.m_X.m_pVal;
+                const uint8_t *pt1_x = rangeproof.m_T2.m_X.m_pVal;
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HdsGenerateRangeproof" << std::endl;
                 std::cout << "is_successful: " << is_successful << std::endl;
@@ -175,13 +169,12 @@ int main()
                 std::cout << "pt0_y: ";
                 print_bin(reinterpret_cast<const uint8_t *>(pt1_x), 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
-            trezor->call_HdsGetPKdf(true, 0, true, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                const uint8_t *key = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsPKdf>(msg).key().c_str());
-                const uint8_t *cofactor_g_x = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsPKdf>(msg).cofactor_g().x().c_str());
-                const uint8_t *cofactor_j_x = reinterpret_cast<const uint8_t *>(child_cast<Message, HdsPKdf>(msg).cofactor_j().x().c_str());
+            trezor->call_HdsGetPKdf(true, 0, true, [&](const HdsCrypto_KdfPub &kdf, SessionHandle session, size_t queue_size) {
+                const uint8_t *key = kdf.m_Secret.m_pVal;
+                const uint8_t *cofactor_g_x = kdf.m_CoFactorG.m_X.m_pVal;
+                const uint8_t *cofactor_j_x = kdf.m_CoFactorJ.m_X.m_pVal;
                 std::cout << "SESSION: " << session << std::endl;
                 std::cout << "HdsGetPKdf" << std::endl;
                 std::cout << "key: ";
@@ -191,17 +184,10 @@ int main()
                 std::cout << "cofactor_j_x: ";
                 print_bin(reinterpret_cast<const uint8_t *>(cofactor_j_x), 32);
                 std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
             });
 
-            trezor->call_HdsGetNumSlots(true, [&, is_alive_idx](const Message &msg, std::string session, size_t queue_size) {
-                uint32_t num_slots = child_cast<Message, HdsNumSlots>(msg).num_slots();
-                std::cout << "SESSION: " << session << std::endl;
-                std::cout << "HdsGetNumSlots" << std::endl;
-                std::cout << "num_slots: " << num_slots << std::endl;
-                std::cout << std::endl;
-                clear_flag(queue_size, is_alive_idx);
-            });
+            // calls of a device run in order, so this one completes last
+            last_calls.push_back(trezor->call_HdsGetNumSlots(true));
         }
         catch (std::runtime_error e)
         {
@@ -209,9 +195,19 @@ int main()
         }
     }
 
-    for (auto& is_alive : is_alive_flags)
-        while (is_alive->test_and_set())
-            ; // waiting
-    curl_global_cleanup();
+    for (auto &last_call : last_calls)
+    {
+        try
+        {
+            auto num_slots = last_call.get();
+            std::cout << "HdsGetNumSlots" << std::endl;
+            std::cout << "num_slots: " << num_slots.num_slots() << std::endl;
+            std::cout << std::endl;
+        }
+        catch (const std::exception &e)
+        {
+            std::cout << "FAIL REASON: " << e.what() << std::endl;
+        }
+    }
     return 0;
 }
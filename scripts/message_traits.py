@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+Generates src/message_traits.hpp: compile-time wire ids, names and
+directions of every message listed in the MessageType enum of messages.proto.
+
+usage: message_traits.py <protob dir> <output header>
+"""
+import os
+import re
+import sys
+from glob import glob
+
+ENUM_VALUE_RE = re.compile(r"^\s*MessageType_(\w+)\s*=\s*(\d+)\s*(?:\[(.*)\])?\s*;")
+PACKAGE_RE = re.compile(r"^package\s+([\w.]+)\s*;", re.M)
+MESSAGE_RE = re.compile(r"^message\s+(\w+)", re.M)
+
+
+def read_message_types(protob):
+    types = []
+    with open(os.path.join(protob, "messages.proto"), "rt") as f:
+        for line in f:
+            match = ENUM_VALUE_RE.match(line)
+            if match:
+                name, number, options = match.groups()
+                options = options or ""
+                types.append(
+                    (name, int(number), "(wire_in)" in options, "(wire_out)" in options)
+                )
+    return types
+
+
+def read_packages(protob):
+    """Maps every top-level message name to the C++ namespace it lives in."""
+    packages = {}
+    for fn in sorted(glob(os.path.join(protob, "messages-*.proto"))):
+        with open(fn, "rt") as f:
+            source = f.read()
+        package = PACKAGE_RE.search(source).group(1)
+        for name in MESSAGE_RE.findall(source):
+            packages[name] = package.split(".")
+    return packages
+
+
+def generate(protob):
+    types = read_message_types(protob)
+    packages = read_packages(protob)
+
+    out = []
+    out.append("// Generated by scripts/message_traits.py from messages.proto, do not edit.")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <cstdint>")
+    out.append("")
+
+    by_namespace = {}
+    for name, _, _, _ in types:
+        if name in packages:
+            by_namespace.setdefault(tuple(packages[name]), []).append(name)
+
+    for namespace in sorted(by_namespace):
+        opening = " ".join("namespace %s {" % n for n in namespace)
+        out.append(opening)
+        for name in by_namespace[namespace]:
+            out.append("class %s;" % name)
+        out.append("}" * len(namespace))
+    out.append("")
+
+    out.append("template <typename T>")
+    out.append("struct message_traits")
+    out.append("{")
+    out.append("    static constexpr bool is_message = false;")
+    out.append("};")
+
+    for name, number, wire_in, wire_out in types:
+        if name not in packages:
+            continue
+        out.append("")
+        out.append("template <>")
+        out.append("struct message_traits<%s>" % "::".join(packages[name] + [name]))
+        out.append("{")
+        out.append("    static constexpr bool is_message = true;")
+        out.append("    static constexpr uint16_t id = %d;" % number)
+        out.append('    static constexpr const char *name = "%s";' % name)
+        out.append("    static constexpr bool wire_in = %s;" % str(wire_in).lower())
+        out.append("    static constexpr bool wire_out = %s;" % str(wire_out).lower())
+        out.append("};")
+
+    out.append("")
+    out.append("constexpr const char *message_type_name(int type)")
+    out.append("{")
+    out.append("    switch (type)")
+    out.append("    {")
+    for name, number, _, _ in sorted(types, key=lambda t: t[1]):
+        out.append("    case %d:" % number)
+        out.append('        return "%s";' % name)
+    out.append("    default:")
+    out.append("        return nullptr;")
+    out.append("    }")
+    out.append("}")
+    out.append("")
+
+    # names to ids without descriptors, which the lite runtime lacks
+    out.append("struct message_type_entry")
+    out.append("{")
+    out.append("    const char *name;")
+    out.append("    uint16_t id;")
+    out.append("};")
+    out.append("")
+    out.append("constexpr message_type_entry message_types[] = {")
+    for name, number, _, _ in types:
+        out.append('    {"%s", %d},' % (name, number))
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__.strip())
+        sys.exit(1)
+    with open(sys.argv[2], "wt") as f:
+        f.write(generate(sys.argv[1]))
@@ -1,76 +1,227 @@
 #pragma once
 
+#include <chrono>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <vector>
 #include "utils.hpp"
 #include "client.hpp"
+#include "transport.hpp"
+#include "queue/concurrent_map.h"
+#include "queue/thread_pool.h"
+#include "queue/timer.h"
 #include "queue/working_queue.h"
 #include "models/models.hpp"
+#include "message_arena.hpp"
+#include "wire/frame_cache.hpp"
+#include "wire/hds_struct_decoder.hpp"
 #include "debug.hpp"
 
+// Carries the Failure a device answered a future-based call with
+class DeviceFailure : public std::runtime_error
+{
+public:
+  explicit DeviceFailure(const Failure &failure)
+      : std::runtime_error(failure.message()), m_failure(failure)
+  {
+  }
+
+  const Failure &failure() const
+  {
+    return m_failure;
+  }
+
+private:
+  Failure m_failure;
+};
+
 class BaseDeviceManager
 {
 public:
-  using MessageCallback = std::function<void(const Message &, std::string, size_t)>;
-  BaseDeviceManager();
+  using MessageCallback = std::function<void(const ProtobufMessage &, SessionHandle, size_t)>;
+  template <typename T>
+  using TypedCallback = std::function<void(const T &, SessionHandle, size_t)>;
+  // With a pool the request and response stages run as strands on it
+  // instead of on two threads of their own
+  explicit BaseDeviceManager(std::unique_ptr<Transport> transport = std::make_unique<Client>(),
+                             std::shared_ptr<ThreadPool> pool = nullptr);
   virtual ~BaseDeviceManager() = 0;
   void init(const Enumerate &enumerate);
   void callback_Failure(MessageCallback callback);
   void callback_Success(MessageCallback callback);
+  // Handles every T response that has no per-call callback
+  template <typename T>
+  void on(TypedCallback<T> callback);
+  // Keeps one bridge session across queued calls instead of acquiring and
+  // releasing it around every message. The session is released after it has
+  // been idle for idle_timeout, by close() or when the manager is destroyed.
+  // A zero timeout turns it off.
+  void enable_session_lease(std::chrono::milliseconds idle_timeout);
+  // Bounds the calls waiting to be sent, 0 for no bound. A call that is
+  // refused or shed under policy gets a Failure instead of its response.
+  // Block must not be used from response callbacks, they would wait on
+  // themselves.
+  void set_request_capacity(size_t capacity, OverflowPolicy policy);
+  // Waits for the queued calls and releases the leased session. It queues
+  // in the bulk lane, so calls of any lane queued before it normally run
+  // first. Must not be called from a response callback.
+  void close();
 
 protected:
-  const std::string GLOBAL_SESSION_ID = "global";
+  const size_t LEASE_RELEASE_KEY = std::numeric_limits<size_t>::max();
+  const size_t NO_REQUEST = std::numeric_limits<size_t>::max();
 
-  virtual void handle_custom_response(const Call &call, const std::string &session) = 0;
-  bool execute_callback(const Message &msg, int type, const std::string &session);
-  template <typename MessageType>
-  bool execute_callback(const Call &call, const std::string &session);
-  void call(std::string message, int type, MessageCallback&& callback) throw();
+  // parses a response into its concrete message type and runs a callback
+  using ResponseHandler = std::function<void(const Call &, SessionHandle, size_t)>;
+
+  template <typename T>
+  static ResponseHandler make_handler(TypedCallback<T> &&callback);
+  // decodes with wire::StructDecoder instead, a malformed response goes to
+  // the global Failure callback
+  template <typename Response>
+  ResponseHandler make_struct_handler(TypedCallback<typename wire::StructDecoder<Response>::Struct> &&callback);
+  // runs the handler set by on() for the type of call
+  bool execute_global_callback(const Call &call, SessionHandle session);
+  // failure_handler takes a Failure answer of this call instead of the global
+  // one. Calls of a higher priority overtake queued calls of lower ones.
+  // Unless the call is Queued, its Failure has already been delivered.
+  PushResult call(std::string message, int type, ResponseHandler&& handler, ResponseHandler&& failure_handler = nullptr,
+                  Priority priority = Priority::Normal) throw();
+  template <typename Response, typename Request>
+  PushResult call(const Request &message, TypedCallback<Response>&& callback, Priority priority = Priority::Normal);
+  // The future holds the response, or DeviceFailure when the device answers
+  // with Failure, the bridge answers with an error or the call is dropped on
+  // a transport error.
+  template <typename Response, typename Request>
+  std::future<Response> call(const Request &message, Priority priority = Priority::Normal);
+  // the same for a request that is already packed into a bridge frame
+  template <typename Response>
+  PushResult call_packed(std::string packed, TypedCallback<Response>&& callback, Priority priority = Priority::Normal);
+  template <typename Response>
+  std::future<Response> call_packed(std::string packed, Priority priority = Priority::Normal);
+  // the callback gets the response as its hw_definitions struct
+  template <typename Response, typename Request>
+  PushResult call_struct(const Request &message, TypedCallback<typename wire::StructDecoder<Response>::Struct>&& callback,
+                         Priority priority = Priority::Normal);
+  template <typename Response>
+  PushResult call_struct_packed(std::string packed, TypedCallback<typename wire::StructDecoder<Response>::Struct>&& callback,
+                                Priority priority = Priority::Normal);
 
 private:
-  Client m_client;
-  WorkingQueue<Call, std::string> m_worker_queue;
+  std::unique_ptr<Transport> m_transport;
+  WorkingQueue<Call, SessionHandle> m_worker_queue;
   WorkingQueue<bool, size_t> m_request_queue;
 
-  std::unordered_map<std::pair<int, std::string>, MessageCallback, pair_hash> m_callbacks;
+  // handlers of one call, dropped as soon as its response or error is in
+  struct PendingRequest
+  {
+    int type = 0;
+    ResponseHandler handler;
+    ResponseHandler failure_handler;
+  };
+
+  // read on every response, written by on() from any thread
+  CopyOnWriteMap<int, ResponseHandler> m_global_handlers;
+  std::atomic<size_t> m_next_request_id{0};
+  std::atomic<size_t> m_in_flight{NO_REQUEST};
+  ShardedMap<size_t, PendingRequest> m_requests;
   std::string m_path = "null";
-  std::string m_session = "null";
+  SessionHandle m_session;
   bool m_is_real = false;
-  
-  void handle_response(const Call &call, const std::string &session);
+
+  std::mutex m_lease_mutex;
+  std::atomic<std::chrono::milliseconds> m_lease_timeout{std::chrono::milliseconds(0)};
+  Timer::Id m_lease_timer = 0;
+  std::atomic<Timer::Clock::rep> m_last_activity{0};
+
+  // async transports complete on their own thread; this keeps them from
+  // touching the queues once the manager is being destroyed
+  struct AsyncGuard
+  {
+    std::mutex mutex;
+    bool alive = true;
+  };
+  std::shared_ptr<AsyncGuard> m_async_guard = std::make_shared<AsyncGuard>();
+
+  void fail_request(size_t request_id, const std::string &reason);
+  void send(SessionHandle session, std::string message);
+  void handle_response(const Call &call, SessionHandle session);
+  bool is_leased() const;
+  void schedule_lease_release();
+  void release_lease(bool force);
 };
 
-inline BaseDeviceManager::BaseDeviceManager()
+inline BaseDeviceManager::BaseDeviceManager(std::unique_ptr<Transport> transport, std::shared_ptr<ThreadPool> pool)
+    : m_transport(std::move(transport)),
+      m_worker_queue(pool),
+      m_request_queue(pool)
 {
   m_worker_queue.setGlobalPopCallback(
-      [&](const std::string &session_pop, const Call &call) {
-        using namespace hw::trezor::messages;
-        if (MessageType_ButtonRequest == call.type)
+      [&](const SessionHandle &session_pop, const Call &call) {
+        if (message_traits<ButtonRequest>::id == call.type)
         {
-          m_worker_queue.push(session_pop, [&](const std::string &session) {
-            return m_client.call(session, pack_message(ButtonAck()));
-          });
+          send(session_pop, wire::constant_frame<ButtonAck>());
         }
         else
         {
-          auto released = m_client.release(session_pop);
-          if (released.session == m_session)
-            m_session = "null";
+          auto session = session_pop;
+          if (!is_leased())
+          {
+            auto released = m_transport->release(session_pop);
+            if (released.session == m_session)
+              m_session = SessionHandle();
+            session = released.session;
+          }
+          else if (!call.error.empty())
+          {
+            // the bridge refused the call, so do not keep reusing that session
+            m_session = SessionHandle();
+          }
+          else
+          {
+            schedule_lease_release();
+          }
 
-          handle_response(call, released.session);
+          handle_response(call, session);
 
           m_request_queue.unlockPop();
         }
       });
+  m_request_queue.setDropCallback([&](const size_t &request_id) {
+    fail_request(request_id, "request dropped to make room");
+  });
 }
 
 inline BaseDeviceManager::~BaseDeviceManager()
 {
+  {
+    std::unique_lock<std::mutex> lock(m_async_guard->mutex);
+    m_async_guard->alive = false;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(m_lease_mutex);
+    m_lease_timeout = std::chrono::milliseconds(0);
+    if (m_lease_timer)
+      Timer::shared().cancel(m_lease_timer);
+  }
+
+  // each stage calls into the other, so both are stopped before either is
+  // destroyed
+  m_request_queue.stop();
+  m_worker_queue.stop();
+
+  // the idle timeout that would have ended the lease is cancelled
+  if (m_session)
+    m_transport->release(m_session);
 }
 
 inline void BaseDeviceManager::init(const Enumerate &enumerate)
 {
-  if (enumerate.session != "null")
+  if (enumerate.session)
     throw std::runtime_error("device already occupied, complete the previous session first");
 
   m_path = enumerate.path;
@@ -80,93 +231,347 @@ inline void BaseDeviceManager::init(const Enumerate &enumerate)
 
 inline void BaseDeviceManager::callback_Failure(MessageCallback callback)
 {
-  using namespace hw::trezor::messages;
-  auto key = std::make_pair(MessageType_Failure, GLOBAL_SESSION_ID);
-  m_callbacks[key] = callback;
+  on<Failure>(std::move(callback));
 }
 
 inline void BaseDeviceManager::callback_Success(MessageCallback callback)
 {
-  using namespace hw::trezor::messages;
-  auto key = std::make_pair(MessageType_Success, GLOBAL_SESSION_ID);
-  m_callbacks[key] = callback;
+  on<Success>(std::move(callback));
+}
+
+template <typename T>
+void BaseDeviceManager::on(TypedCallback<T> callback)
+{
+  if (auto handler = make_handler(std::move(callback)))
+    m_global_handlers.set(message_traits<T>::id, std::move(handler));
+  else
+    m_global_handlers.erase(message_traits<T>::id);
+}
+
+template <typename T>
+BaseDeviceManager::ResponseHandler BaseDeviceManager::make_handler(TypedCallback<T> &&callback)
+{
+  if (!callback)
+    return nullptr;
+
+  return [callback = std::move(callback)](const Call &call, SessionHandle session, size_t queue_size) {
+    MessageArena arena;
+    auto message = arena.create<T>();
+    call.parse_into(*message);
+    callback(*message, session, queue_size);
+  };
 }
 
-inline bool BaseDeviceManager::execute_callback(const Message &msg, int type, const std::string &session)
+template <typename Response>
+BaseDeviceManager::ResponseHandler BaseDeviceManager::make_struct_handler(TypedCallback<typename wire::StructDecoder<Response>::Struct> &&callback)
+{
+  if (!callback)
+    return nullptr;
+
+  return [&, callback = std::move(callback)](const Call &call, SessionHandle session, size_t queue_size) {
+    typename wire::StructDecoder<Response>::Struct value;
+    if (wire::StructDecoder<Response>::decode(call.msg.data(), call.length, value))
+    {
+      callback(value, session, queue_size);
+      return;
+    }
+
+    Failure failure;
+    failure.set_message("malformed " + get_message_type_name(call.type));
+    auto failure_call = make_call(failure);
+    if (!execute_global_callback(failure_call, session))
+      print_call_response(failure_call);
+  };
+}
+
+inline void BaseDeviceManager::enable_session_lease(std::chrono::milliseconds idle_timeout)
+{
+  std::unique_lock<std::mutex> lock(m_lease_mutex);
+  m_lease_timeout = idle_timeout;
+}
+
+inline void BaseDeviceManager::set_request_capacity(size_t capacity, OverflowPolicy policy)
+{
+  m_request_queue.setCapacity(capacity, policy);
+}
+
+inline void BaseDeviceManager::close()
 {
-  auto key = std::make_pair(type, session);
-  auto callback = m_callbacks.find(key);
-  if (callback != m_callbacks.end())
   {
-    callback->second(msg, session, m_request_queue.size());
+    std::unique_lock<std::mutex> lock(m_lease_mutex);
+    if (m_lease_timer)
+      Timer::shared().cancel(m_lease_timer);
+    m_lease_timer = 0;
+  }
+
+  auto released = std::make_shared<std::promise<void>>();
+  m_request_queue.push(LEASE_RELEASE_KEY, [&, released](size_t) {
+    release_lease(true);
+    released->set_value();
     return true;
+  }, nullptr, Priority::Bulk, false);
+  released->get_future().wait();
+}
+
+inline bool BaseDeviceManager::is_leased() const
+{
+  return m_lease_timeout.load().count() != 0;
+}
+
+inline void BaseDeviceManager::schedule_lease_release()
+{
+  std::unique_lock<std::mutex> lock(m_lease_mutex);
+  if (!is_leased())
+    return;
+
+  m_last_activity = Timer::Clock::now().time_since_epoch().count();
+  if (m_lease_timer)
+    Timer::shared().cancel(m_lease_timer);
+
+  m_lease_timer = Timer::shared().schedule(m_lease_timeout.load(), [&] {
+    m_request_queue.push(LEASE_RELEASE_KEY, [&](size_t) {
+      release_lease(false);
+      return true;
+    }, nullptr, Priority::Normal, false);
+  });
+}
+
+inline void BaseDeviceManager::release_lease(bool force)
+{
+  if (!m_session)
+    return;
+
+  if (!force)
+  {
+    // a call may have renewed the lease after the timer fired
+    auto idle = Timer::Clock::now().time_since_epoch() - Timer::Clock::duration(m_last_activity.load());
+    if (is_leased() && idle < m_lease_timeout.load())
+      return;
   }
-  return false;
+
+  m_transport->release(m_session);
+  m_session = SessionHandle();
 }
 
-template <typename MessageType>
-bool BaseDeviceManager::execute_callback(const Call &call, const std::string &session)
+inline bool BaseDeviceManager::execute_global_callback(const Call &call, SessionHandle session)
 {
-  return execute_callback(call.to_message<MessageType>(), call.type, session);
+  // the snapshot keeps the handler alive even if on() replaces it meanwhile
+  auto handlers = m_global_handlers.snapshot();
+  auto found = handlers->find(call.type);
+  if (found == handlers->end())
+    return false;
+
+  found->second(call, session, m_request_queue.size());
+  return true;
 }
 
-inline void BaseDeviceManager::call(std::string message, int type, MessageCallback&& callback) throw()
+inline PushResult BaseDeviceManager::call(std::string message, int type, ResponseHandler&& handler, ResponseHandler&& failure_handler,
+                                           Priority priority) throw()
 {
-  m_request_queue.push(m_request_queue.size(), [&, message, type, callback=std::move(callback)](size_t size) {
-    if (m_session != "null")
+  // the id keys the call in the request queue too, where a push with the
+  // same key would replace it
+  auto request_id = m_next_request_id++;
+  m_requests.emplace(request_id, PendingRequest{type, std::move(handler), std::move(failure_handler)});
+
+  auto result = m_request_queue.push(request_id, [&, message=std::move(message)](size_t id) mutable {
+    if (!m_session)
+    {
+      auto acquired = m_transport->acquire(m_path, m_session);
+      if (!acquired.error.empty())
+      {
+        fail_request(id, acquired.error);
+        return true;
+      }
+      m_session = acquired.session;
+    }
+    else if (!is_leased())
     {
       throw std::runtime_error("previous session must be completed");
       // return false; //TODO: decide which better (throw or return false)
     }
 
-    auto acquired = m_client.acquire(m_path, m_session);
-    if (acquired.error.empty())
+    m_in_flight = id;
+    // lock before handing over, the response may arrive before push returns
+    m_request_queue.lockPop();
+    send(m_session, std::move(message));
+    return true;
+  }, nullptr, priority);
+
+  switch (result)
+  {
+  case PushResult::Full:
+    fail_request(request_id, "request queue is full");
+    break;
+  case PushResult::Closed:
+  case PushResult::Locked:
+    fail_request(request_id, "request queue is closed");
+    break;
+  default:
+    break;
+  }
+  return result;
+}
+
+template <typename Response, typename Request>
+PushResult BaseDeviceManager::call(const Request &message, TypedCallback<Response>&& callback, Priority priority)
+{
+  static_assert(message_traits<Request>::wire_in, "request must be sent from host to device");
+  static_assert(message_traits<Response>::wire_out || std::is_same<Request, Response>::value,
+                "response must be sent from device to host or echo the request");
+  return call_packed<Response>(pack_message(message), std::move(callback), priority);
+}
+
+template <typename Response, typename Request>
+std::future<Response> BaseDeviceManager::call(const Request &message, Priority priority)
+{
+  static_assert(message_traits<Request>::wire_in, "request must be sent from host to device");
+  static_assert(message_traits<Response>::wire_out || std::is_same<Request, Response>::value,
+                "response must be sent from device to host or echo the request");
+  return call_packed<Response>(pack_message(message), priority);
+}
+
+template <typename Response, typename Request>
+PushResult BaseDeviceManager::call_struct(const Request &message, TypedCallback<typename wire::StructDecoder<Response>::Struct>&& callback,
+                                          Priority priority)
+{
+  static_assert(message_traits<Request>::wire_in, "request must be sent from host to device");
+  static_assert(message_traits<Response>::wire_out, "response must be sent from device to host");
+  return call_struct_packed<Response>(pack_message(message), std::move(callback), priority);
+}
+
+template <typename Response>
+PushResult BaseDeviceManager::call_struct_packed(std::string packed, TypedCallback<typename wire::StructDecoder<Response>::Struct>&& callback,
+                                                 Priority priority)
+{
+  return call(std::move(packed), message_traits<Response>::id, make_struct_handler<Response>(std::move(callback)), nullptr,
+              priority);
+}
+
+template <typename Response>
+PushResult BaseDeviceManager::call_packed(std::string packed, TypedCallback<Response>&& callback, Priority priority)
+{
+  return call(std::move(packed), message_traits<Response>::id, make_handler(std::move(callback)), nullptr, priority);
+}
+
+template <typename Response>
+std::future<Response> BaseDeviceManager::call_packed(std::string packed, Priority priority)
+{
+  auto promise = std::make_shared<std::promise<Response>>();
+  auto future = promise->get_future();
+
+  TypedCallback<Response> callback = [promise](const Response &response, SessionHandle, size_t) {
+    promise->set_value(response);
+  };
+  TypedCallback<Failure> failure_callback = [promise](const Failure &failure, SessionHandle, size_t) {
+    promise->set_exception(std::make_exception_ptr(DeviceFailure(failure)));
+  };
+
+  call(std::move(packed), message_traits<Response>::id, make_handler(std::move(callback)), make_handler(std::move(failure_callback)),
+       priority);
+  return future;
+}
+
+// a call that never reached the device answers with a Failure of its own,
+// through the global callback when it has no handler
+inline void BaseDeviceManager::fail_request(size_t request_id, const std::string &reason)
+{
+  Failure failure;
+  failure.set_message(reason);
+  auto call = make_call(failure);
+
+  PendingRequest request;
+  if (m_requests.take(request_id, request) && request.failure_handler)
+    request.failure_handler(call, SessionHandle(), m_request_queue.size());
+  else
+    execute_global_callback(call, SessionHandle());
+}
+
+inline void BaseDeviceManager::send(SessionHandle session, std::string message)
+{
+  if (!m_transport->is_async())
+  {
+    m_worker_queue.push(session, [&, message=std::move(message)](const SessionHandle &session_call) mutable {
+      auto response = m_transport->call(session_call, message);
+      // the frame is reused by the next pack_message
+      BufferPool::hex().give_back(std::move(message));
+      return response;
+    });
+    return;
+  }
+
+  // the response is handed to the worker queue, so callbacks keep running
+  // on the device's own thread and never stall the shared event loop
+  auto guard = m_async_guard;
+  m_transport->call_async(session, std::move(message), [&, guard, session](Call response) {
+    std::unique_lock<std::mutex> lock(guard->mutex);
+    if (guard->alive)
     {
-      m_session = acquired.session;
-      if (callback)
-      {
-        auto key = std::make_pair(type, m_session);
-        m_callbacks[key] = std::move(callback);
-      }
-      m_worker_queue.push(m_session, [&, message](const std::string &session) {
-        return m_client.call(session, message);
+      m_worker_queue.push(session, [response=std::move(response)](const SessionHandle &) {
+        return response;
       });
-
-      m_request_queue.lockPop();
     }
-    return true;
   });
 }
 
-inline void BaseDeviceManager::handle_response(const Call &call, const std::string &session)
+inline void BaseDeviceManager::handle_response(const Call &call, SessionHandle session)
 {
   using namespace hw::trezor::messages;
 
-  switch (call.type)
-  {
-  case MessageType_Failure:
-    if (!execute_callback<Failure>(call, session))
-      execute_callback<Failure>(call, GLOBAL_SESSION_ID);
-    break;
-  case MessageType_Success:
-    if (!execute_callback<Success>(call, session))
-      execute_callback<Success>(call, GLOBAL_SESSION_ID);
-    break;
-  case INTERNAL_ERROR:
+  if (call.type == INTERNAL_ERROR)
   {
     print_call_response(call);
 
-    m_session = "null";
-    m_request_queue.clear();
+    m_session = SessionHandle();
+    // The call in flight and the queued ones fail with the transport error,
+    // the global callback hears of it when there were none. A call pushed
+    // after the clear is still sent, so it is not failed either.
+    std::vector<size_t> dropped;
+    auto in_flight = m_in_flight.exchange(NO_REQUEST);
+    if (in_flight != NO_REQUEST)
+      dropped.push_back(in_flight);
+    m_request_queue.clear([&](const size_t &request_id) {
+      if (request_id != LEASE_RELEASE_KEY)
+        dropped.push_back(request_id);
+    });
     m_worker_queue.clear();
+    for (auto request_id : dropped)
+      fail_request(request_id, call.error);
 
-    Failure error;
-    error.set_message(call.error);
-    execute_callback(error, MessageType_Failure, GLOBAL_SESSION_ID);
-    break;
+    if (dropped.empty())
+    {
+      Failure error;
+      error.set_message(call.error);
+      execute_global_callback(make_call(error), SessionHandle());
+    }
+    return;
   }
-  default:
-    handle_custom_response(call, session);
-    break;
+
+  if (!call.error.empty())
+  {
+    // the bridge answered the call with an error instead of a message
+    fail_request(m_in_flight.exchange(NO_REQUEST), call.error);
+    return;
+  }
+
+  // the response ends its request whatever its type, only one is in flight
+  PendingRequest request;
+  if (m_requests.take(m_in_flight.exchange(NO_REQUEST), request))
+  {
+    if (call.type == request.type && request.handler)
+    {
+      request.handler(call, session, m_request_queue.size());
+      return;
+    }
+    if (call.type == message_traits<Failure>::id && request.failure_handler)
+    {
+      request.failure_handler(call, session, m_request_queue.size());
+      return;
+    }
+  }
+
+  if (!execute_global_callback(call, session))
+  {
+    // nobody expects this response, at least make it visible
+    print_call_response(call);
   }
 }
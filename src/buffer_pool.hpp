@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Strings that keep their capacity from one request to the next. A buffer
+// is usually taken on the thread that packs a request and given back on
+// the device's worker thread once it is sent, so the free list is shared.
+class BufferPool
+{
+  public:
+    // hex frames made by pack_message
+    static BufferPool &hex()
+    {
+        static BufferPool pool;
+        return pool;
+    }
+
+    BufferPool()
+    {
+        m_free.reserve(MAX_FREE);
+    }
+
+    BufferPool(const BufferPool &) = delete;            // disable copying
+    BufferPool &operator=(const BufferPool &) = delete; // disable assignment
+
+    std::string take(size_t size)
+    {
+        std::string buffer;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_free.empty())
+            {
+                buffer = std::move(m_free.back());
+                m_free.pop_back();
+            }
+        }
+        buffer.resize(size);
+        return buffer;
+    }
+
+    // oversized buffers are not kept, one big request must not pin its memory
+    void give_back(std::string &&buffer)
+    {
+        if (buffer.capacity() > MAX_CAPACITY)
+            return;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_free.size() < MAX_FREE)
+            m_free.push_back(std::move(buffer));
+    }
+
+  private:
+    static constexpr size_t MAX_FREE = 64;
+    static constexpr size_t MAX_CAPACITY = 64 * 1024;
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_free;
+};
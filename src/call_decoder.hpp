@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include "hex.hpp"
+#include "json.hpp"
+#include "models/models.hpp"
+#include "utils.hpp"
+
+// Decodes a bridge /call response as it arrives. Hex digits go straight
+// into the Call's message buffer, which is sized from the header as soon
+// as the header is in. A response starting with '{' is a JSON error and is
+// kept as text. Input that is not hex or announces a message larger than
+// MAX_MESSAGE_SIZE turns the decoder invalid, and the rest is refused.
+class CallDecoder
+{
+  public:
+    static constexpr size_t HEADER_SIZE = sizeof(Call::type) + sizeof(Call::length);
+    static constexpr size_t MAX_MESSAGE_SIZE = 1024 * 1024;
+
+    // false once the response is invalid
+    bool append(const char *data, size_t size)
+    {
+        if (m_state == State::Invalid)
+            return false;
+        if (size == 0)
+            return true;
+        if (m_state == State::Empty)
+            m_state = data[0] == '{' ? State::Json : State::Hex;
+
+        if (m_state == State::Json)
+        {
+            if (m_text.size() + size > MAX_MESSAGE_SIZE)
+                return fail("response is too large");
+            m_text.append(data, size);
+            return true;
+        }
+
+        // a digit pair split across two chunks
+        if (m_has_carry)
+        {
+            const char pair[] = {m_carry, data[0]};
+            if (!decode(pair, 2))
+                return false;
+            data++;
+            size--;
+            m_has_carry = false;
+        }
+
+        if (!decode(data, size & ~size_t(1)))
+            return false;
+        if (size & 1)
+        {
+            m_carry = data[size - 1];
+            m_has_carry = true;
+        }
+        return true;
+    }
+
+    bool is_invalid() const
+    {
+        return m_state == State::Invalid;
+    }
+
+    Call finish()
+    {
+        Call call;
+        switch (m_state)
+        {
+        case State::Empty:
+            call.type = INTERNAL_ERROR;
+            call.error = "response is empty";
+            break;
+        case State::Json:
+            call.error = parse_error();
+            if (call.error.empty())
+            {
+                call.type = INTERNAL_ERROR;
+                call.error = "unexpected response: " + m_text;
+            }
+            break;
+        case State::Hex:
+            if (m_decoded < HEADER_SIZE + m_call.length)
+            {
+                call.type = INTERNAL_ERROR;
+                call.error = "response is truncated";
+                break;
+            }
+            call = std::move(m_call);
+            break;
+        case State::Invalid:
+        default:
+            call.type = INTERNAL_ERROR;
+            call.error = m_error;
+            break;
+        }
+
+        *this = CallDecoder();
+        return call;
+    }
+
+    // Returning less than it got aborts the transfer. Nothing may be thrown
+    // through the C frames of libcurl.
+    static size_t write_callback(char *contents, size_t size, size_t nmemb, void *userp)
+    {
+        auto decoder = static_cast<CallDecoder *>(userp);
+        try
+        {
+            return decoder->append(contents, size * nmemb) ? size * nmemb : 0;
+        }
+        catch (...)
+        {
+            decoder->fail("response could not be decoded");
+            return 0;
+        }
+    }
+
+  private:
+    enum class State
+    {
+        Empty,
+        Hex,
+        Json,
+        Invalid
+    };
+
+    bool fail(const char *error)
+    {
+        m_state = State::Invalid;
+        m_error = error;
+        return false;
+    }
+
+    // size is an even number of hex digits
+    bool decode(const char *hex, size_t size)
+    {
+        size_t bytes = size / 2;
+        if (m_decoded < HEADER_SIZE)
+        {
+            auto count = std::min(bytes, HEADER_SIZE - m_decoded);
+            if (!hex::is_valid(hex, 2 * count))
+                return fail("response is not hex");
+            hex::decode(hex, 2 * count, m_header + m_decoded);
+            m_decoded += count;
+            hex += 2 * count;
+            bytes -= count;
+
+            if (m_decoded == HEADER_SIZE)
+            {
+                copy_reversed(m_header, &m_call.type);
+                copy_reversed(m_header + sizeof(m_call.type), &m_call.length);
+                // the length is not trusted before it is checked
+                if (m_call.length > MAX_MESSAGE_SIZE)
+                    return fail("response is too large");
+                m_call.msg.resize(m_call.length);
+            }
+        }
+
+        // anything after the message is ignored
+        auto offset = m_decoded - HEADER_SIZE;
+        auto count = std::min<size_t>(bytes, m_call.length - std::min<size_t>(offset, m_call.length));
+        if (count == 0)
+            return true;
+        if (!hex::is_valid(hex, 2 * count))
+            return fail("response is not hex");
+        hex::decode(hex, 2 * count, m_call.msg.data() + offset);
+        m_decoded += count;
+        return true;
+    }
+
+    std::string parse_error() const
+    {
+        try
+        {
+            return nlohmann::json::parse(m_text.c_str(), m_text.c_str() + m_text.size()).get<Error>().error;
+        }
+        catch (const nlohmann::detail::exception &)
+        {
+            return {};
+        }
+    }
+
+    State m_state = State::Empty;
+    Call m_call;
+    uint8_t m_header[HEADER_SIZE] = {};
+    size_t m_decoded = 0;
+    char m_carry = 0;
+    bool m_has_carry = false;
+    std::string m_text;
+    const char *m_error = "";
+};
@@ -1,17 +1,33 @@
 #pragma once
 
+#include <future>
 #include <iostream>
+#include <memory>
 #include <utility>
 #include <vector>
 #include <curl/curl.h>
+#include "call_decoder.hpp"
+#include "curl_global.hpp"
+#include "curl_multi_loop.hpp"
 #include "models/models.hpp"
 #include "json.hpp"
+#include "transport.hpp"
 #include "utils.hpp"
 
-class Client
+class Client : public Transport
 {
   public:
-    Client() : m_Curl(curl_easy_init())
+    // Blocking clients own a curl easy handle and perform on the calling
+    // thread. Async clients hand every request to the shared CurlMultiLoop.
+    enum class Mode
+    {
+        Blocking,
+        Async
+    };
+
+    explicit Client(Mode mode = Mode::Blocking)
+        : m_Curl(mode == Mode::Blocking ? easy_init() : nullptr),
+          m_Mode(mode)
     {
     }
 
@@ -27,46 +43,57 @@ class Client
         m_Curl = nullptr;
     }
 
-    std::vector<Enumerate> enumerate() const
+    std::vector<Enumerate> enumerate() const override
     {
         return perform<std::vector<Enumerate>>("/enumerate").first;
     }
 
-    Session acquire(std::string path, std::string previousSession = "null") const
+    Session acquire(std::string path, SessionHandle previousSession = SessionHandle()) const override
     {
-        return perform<Session>("/acquire/" + path + "/" + previousSession).first;
+        return perform<Session>("/acquire/" + path + "/" + previousSession.to_string()).first;
     }
 
-    Session release(std::string session) const
+    Session release(SessionHandle session) const override
     {
-        return perform<Session>("/release/" + session).first;
+        return perform<Session>("/release/" + session.to_string()).first;
     }
 
-    Call call(std::string session, std::string hex) const
+    Call call(SessionHandle session, const std::string &hex) const override
     {
-        Call response;
-        auto result = perform<Error>("/call/" + session, hex.c_str());
-        if (result.first.error.empty())
+        if (m_Mode == Mode::Async)
         {
-            auto raw = result.second;
-            if (raw.size() > 0)
-            {
-                std::unique_ptr<unsigned char[]> bytes(new unsigned char[raw.length() / 2]);
-                hex2bin(raw.c_str(), raw.length(), bytes.get());
-                response.from_bytes(bytes.get());
-            }
-            else
-            {
-                response.type = INTERNAL_ERROR;
-                response.error = "response is empty";
-            }
-        }
-        else
-        {
-            response.error = result.first.error;
+            std::promise<Call> result;
+            call_async(session, hex, [&result](Call response) { result.set_value(std::move(response)); });
+            return result.get_future().get();
         }
 
-        return response;
+        // decoded while curl receives it, the hex text is never stored
+        CallDecoder decoder;
+        // an invalid response aborts the transfer, its error is kept
+        if (!perform("/call/" + session.to_string(), hex.c_str(), CallDecoder::write_callback, &decoder) &&
+            !decoder.is_invalid())
+            return CallDecoder().finish();
+        return decoder.finish();
+    }
+
+    bool is_async() const override
+    {
+        return m_Mode == Mode::Async;
+    }
+
+    void call_async(SessionHandle session, std::string hex, CallHandler done) const override
+    {
+        if (m_Mode != Mode::Async)
+            return Transport::call_async(session, hex, done);
+
+        // decoded on the loop's thread as it arrives, like the blocking call;
+        // done owns the decoder until the transfer is over
+        auto decoder = std::make_shared<CallDecoder>();
+        CurlMultiLoop::shared().perform(
+            static_cast<std::string>(TREZORD_HOST) + "/call/" + session.to_string(), std::move(hex), TREZORD_ORIGIN_HEADER,
+            CallDecoder::write_callback, decoder.get(), [done, decoder](CURLcode result, std::string) {
+                done(result == CURLE_OK || decoder->is_invalid() ? decoder->finish() : CallDecoder().finish());
+            });
     }
 
   protected:
@@ -74,6 +101,12 @@ class Client
     std::pair<T, std::string> perform(std::string url, const char *body = nullptr) const
     {
         auto result = perform(url, body);
+        return std::make_pair(parse<T>(result), result);
+    }
+
+    template <typename T>
+    static T parse(const std::string &result)
+    {
         T response;
 
         if (!result.empty())
@@ -94,47 +127,67 @@ class Client
             }
         }
 
-        return std::make_pair(response, result);
+        return response;
     }
 
     std::string perform(std::string url, const char *body = nullptr) const
     {
-        if (!m_Curl)
-            return {};
+        if (m_Mode == Mode::Async)
+        {
+            std::promise<std::string> result;
+            CurlMultiLoop::shared().perform(
+                static_cast<std::string>(TREZORD_HOST) + url, body != nullptr ? body : "", TREZORD_ORIGIN_HEADER,
+                [&result](CURLcode, std::string buffer) { result.set_value(std::move(buffer)); });
+            return result.get_future().get();
+        }
 
         std::string buffer;
+        if (!perform(url, body, write_callback, &buffer))
+            return {};
+        return buffer;
+    }
+
+    // blocking only, data gets the response through write
+    bool perform(const std::string &url, const char *body, curl_write_callback write, void *data) const
+    {
+        if (!m_Curl)
+            return false;
+
         struct curl_slist *chunk = NULL;
         chunk = curl_slist_append(chunk, TREZORD_ORIGIN_HEADER);
 
         curl_easy_setopt(m_Curl, CURLOPT_HTTPHEADER, chunk);
         curl_easy_setopt(m_Curl, CURLOPT_URL, (static_cast<std::string>(TREZORD_HOST) + url).c_str());
         curl_easy_setopt(m_Curl, CURLOPT_POST, 1L);
-        curl_easy_setopt(m_Curl, CURLOPT_WRITEFUNCTION, write_callback);
-        curl_easy_setopt(m_Curl, CURLOPT_WRITEDATA, &buffer);
+        curl_easy_setopt(m_Curl, CURLOPT_WRITEFUNCTION, write);
+        curl_easy_setopt(m_Curl, CURLOPT_WRITEDATA, data);
 
-        if (body != nullptr)
-        {
-            curl_easy_setopt(m_Curl, CURLOPT_POSTFIELDS, body);
-        }
+        // always set the body, otherwise the handle keeps pointing at the
+        // previous request's body or reads the POST data from stdin
+        curl_easy_setopt(m_Curl, CURLOPT_POSTFIELDS, body != nullptr ? body : "");
 
         CURLcode res = curl_easy_perform(m_Curl);
         curl_slist_free_all(chunk);
 
-        if (res == CURLE_OK)
-            return buffer;
-
-        return {};
+        return res == CURLE_OK;
     }
 
   private:
     CURL *m_Curl = nullptr;
+    Mode m_Mode;
 
     static constexpr const char *TREZORD_HOST = "http://127.0.0.1:21325";
     static constexpr const char *TREZORD_ORIGIN_HEADER = "Origin: https://hds.trezor.io";
 
-    static size_t write_callback(void *contents, size_t size, size_t nmemb, void *userp)
+    static CURL *easy_init()
+    {
+        CurlGlobal::ensure();
+        return curl_easy_init();
+    }
+
+    static size_t write_callback(char *contents, size_t size, size_t nmemb, void *userp)
     {
-        static_cast<std::string *>(userp)->append(static_cast<char *>(contents), size * nmemb);
+        static_cast<std::string *>(userp)->append(contents, size * nmemb);
         return size * nmemb;
     }
 };
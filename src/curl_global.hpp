@@ -0,0 +1,31 @@
+#pragma once
+
+#include <curl/curl.h>
+
+// Process-wide libcurl setup. curl_global_init is not thread-safe, so it
+// runs once here rather than inside whichever curl_easy_init comes first.
+// The cleanup runs at exit, after every static that was set up after it,
+// the shared CurlMultiLoop included.
+class CurlGlobal
+{
+  public:
+    static void ensure()
+    {
+        static CurlGlobal global;
+        (void)global;
+    }
+
+    CurlGlobal(const CurlGlobal &) = delete;            // disable copying
+    CurlGlobal &operator=(const CurlGlobal &) = delete; // disable assignment
+
+  private:
+    CurlGlobal()
+    {
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+    }
+
+    ~CurlGlobal()
+    {
+        curl_global_cleanup();
+    }
+};
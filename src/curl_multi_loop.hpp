@@ -0,0 +1,203 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <curl/curl.h>
+#include "curl_global.hpp"
+
+// Drives every outstanding bridge request of the process from one thread
+// with curl_multi. Completion callbacks run on that thread, so they must not
+// block; hand the result over to a queue instead.
+class CurlMultiLoop
+{
+  public:
+    using Done = std::function<void(CURLcode, std::string)>;
+
+    static CurlMultiLoop &shared()
+    {
+        static CurlMultiLoop loop;
+        return loop;
+    }
+
+    CurlMultiLoop()
+        : m_Multi(multi_init()),
+          m_thread(&CurlMultiLoop::_threadMain, this)
+    {
+    }
+
+    CurlMultiLoop(const CurlMultiLoop &) = delete;            // disable copying
+    CurlMultiLoop &operator=(const CurlMultiLoop &) = delete; // disable assignment
+
+    ~CurlMultiLoop()
+    {
+        m_alive = false;
+        if (m_Multi)
+            curl_multi_wakeup(m_Multi);
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+
+        for (auto &active : m_active)
+        {
+            curl_multi_remove_handle(m_Multi, active.first);
+            release(std::move(active.second));
+        }
+        for (auto easy : m_idle)
+            curl_easy_cleanup(easy);
+        if (m_Multi)
+            curl_multi_cleanup(m_Multi);
+    }
+
+    // done gets the whole response body
+    void perform(std::string url, std::string body, const char *header, Done done)
+    {
+        perform(std::move(url), std::move(body), header, nullptr, nullptr, std::move(done));
+    }
+
+    // write gets the response with data as it arrives and done gets no body.
+    // data must live until done has run, done may own it.
+    void perform(std::string url, std::string body, const char *header, curl_write_callback write, void *data, Done done)
+    {
+        std::unique_ptr<Request> request(new Request());
+        request->url = std::move(url);
+        request->body = std::move(body);
+        request->header = header;
+        request->write = write != nullptr ? write : write_callback;
+        request->data = write != nullptr ? data : &request->buffer;
+        request->done = std::move(done);
+
+        {
+            std::unique_lock<std::mutex> mlock(m_mutex);
+            m_pending.push_back(std::move(request));
+        }
+        curl_multi_wakeup(m_Multi);
+    }
+
+  private:
+    struct Request
+    {
+        CURL *easy = nullptr;
+        curl_slist *headers = nullptr;
+        std::string url;
+        std::string body;
+        const char *header = nullptr;
+        curl_write_callback write = nullptr;
+        void *data = nullptr;
+        std::string buffer;
+        Done done;
+    };
+
+    void _threadMain()
+    {
+        if (!m_Multi)
+            return;
+
+        while (m_alive)
+        {
+            start_pending();
+
+            int running = 0;
+            curl_multi_perform(m_Multi, &running);
+
+            int left = 0;
+            while (CURLMsg *message = curl_multi_info_read(m_Multi, &left))
+            {
+                if (message->msg != CURLMSG_DONE)
+                    continue;
+
+                auto easy = message->easy_handle;
+                auto result = message->data.result;
+                auto active = m_active.find(easy);
+                curl_multi_remove_handle(m_Multi, easy);
+
+                if (active != m_active.end())
+                {
+                    auto request = std::move(active->second);
+                    m_active.erase(active);
+                    request->done(result, result == CURLE_OK ? std::move(request->buffer) : std::string());
+                    release(std::move(request));
+                }
+            }
+
+            curl_multi_poll(m_Multi, nullptr, 0, POLL_TIMEOUT_MILLIS, nullptr);
+        }
+    }
+
+    void start_pending()
+    {
+        std::vector<std::unique_ptr<Request>> pending;
+        {
+            std::unique_lock<std::mutex> mlock(m_mutex);
+            pending.swap(m_pending);
+        }
+
+        for (auto &request : pending)
+        {
+            if (m_idle.empty())
+            {
+                request->easy = curl_easy_init();
+            }
+            else
+            {
+                request->easy = m_idle.back();
+                m_idle.pop_back();
+                curl_easy_reset(request->easy);
+            }
+
+            if (!request->easy)
+            {
+                request->done(CURLE_FAILED_INIT, {});
+                continue;
+            }
+
+            request->headers = curl_slist_append(request->headers, request->header);
+            curl_easy_setopt(request->easy, CURLOPT_HTTPHEADER, request->headers);
+            curl_easy_setopt(request->easy, CURLOPT_URL, request->url.c_str());
+            curl_easy_setopt(request->easy, CURLOPT_POST, 1L);
+            curl_easy_setopt(request->easy, CURLOPT_POSTFIELDS, request->body.c_str());
+            curl_easy_setopt(request->easy, CURLOPT_WRITEFUNCTION, request->write);
+            curl_easy_setopt(request->easy, CURLOPT_WRITEDATA, request->data);
+
+            curl_multi_add_handle(m_Multi, request->easy);
+            auto easy = request->easy;
+            m_active[easy] = std::move(request);
+        }
+    }
+
+    // keeps the easy handle around, so its connection can be reused
+    void release(std::unique_ptr<Request> request)
+    {
+        curl_slist_free_all(request->headers);
+        if (request->easy)
+            m_idle.push_back(request->easy);
+    }
+
+    static CURLM *multi_init()
+    {
+        CurlGlobal::ensure();
+        return curl_multi_init();
+    }
+
+    static size_t write_callback(char *contents, size_t size, size_t nmemb, void *userp)
+    {
+        static_cast<std::string *>(userp)->append(contents, size * nmemb);
+        return size * nmemb;
+    }
+
+    static constexpr int POLL_TIMEOUT_MILLIS = 1000;
+
+    CURLM *m_Multi = nullptr;
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Request>> m_pending;
+    std::unordered_map<CURL *, std::unique_ptr<Request>> m_active;
+    std::vector<CURL *> m_idle;
+    std::atomic_bool m_alive{true};
+    std::thread m_thread;
+};
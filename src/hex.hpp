@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HEX_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+// Hex codecs for the bridge wire format. Encoding writes lowercase digits,
+// decoding accepts both cases. The SSE2/AVX2 kernels handle whole blocks and
+// leave the tail to the scalar code; the best one is picked on first use.
+
+namespace hex
+{
+
+using EncodeFunction = void (*)(const uint8_t *, size_t, char *);
+using DecodeFunction = void (*)(const char *, size_t, uint8_t *);
+using ValidateFunction = bool (*)(const char *, size_t);
+
+inline uint8_t digit_value(char digit)
+{
+    auto c = static_cast<uint8_t>(digit) | 0x20; // lowercase letters, digits stay
+    return static_cast<uint8_t>(c >= 'a' ? c - 'a' + 10 : c - '0') & 0x0f;
+}
+
+// true when every character is a hex digit, of either case; no early exit,
+// so the loop stays branch-free
+inline bool is_valid_scalar(const char *hex, size_t size)
+{
+    uint8_t invalid = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        auto c = static_cast<uint8_t>(hex[i]);
+        auto digit = static_cast<uint8_t>(c - '0');
+        auto letter = static_cast<uint8_t>((c | 0x20) - 'a');
+        invalid |= static_cast<uint8_t>((digit > 9) & (letter > 5));
+    }
+    return invalid == 0;
+}
+
+inline void encode_scalar(const uint8_t *bytes, size_t size, char *out)
+{
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < size; i++)
+    {
+        out[2 * i] = digits[bytes[i] >> 4];
+        out[2 * i + 1] = digits[bytes[i] & 0x0f];
+    }
+}
+
+// size is the number of hex digits; an odd trailing digit is ignored
+inline void decode_scalar(const char *hex, size_t size, uint8_t *out)
+{
+    for (size_t i = 0; i < size / 2; i++)
+        out[i] = static_cast<uint8_t>(digit_value(hex[2 * i]) << 4 | digit_value(hex[2 * i + 1]));
+}
+
+#ifdef HEX_X86_KERNELS
+
+__attribute__((target("sse2"))) inline __m128i nibbles_to_digits_sse2(__m128i nibbles)
+{
+    auto letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+__attribute__((target("sse2"))) inline __m128i digits_to_bytes_sse2(__m128i digits)
+{
+    auto lower = _mm_or_si128(digits, _mm_set1_epi8(0x20));
+    auto letters = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_set1_epi8('a' - '0' - 10));
+    auto nibbles = _mm_sub_epi8(_mm_sub_epi8(lower, _mm_set1_epi8('0')), letters);
+    // each 16-bit lane holds the high digit in its low byte
+    auto high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x0f)), 4);
+    auto low = _mm_and_si128(_mm_srli_epi16(nibbles, 8), _mm_set1_epi16(0x0f));
+    return _mm_or_si128(high, low);
+}
+
+__attribute__((target("sse2"))) inline void encode_sse2(const uint8_t *bytes, size_t size, char *out)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+        auto high = nibbles_to_digits_sse2(_mm_and_si128(_mm_srli_epi16(block, 4), _mm_set1_epi8(0x0f)));
+        auto low = nibbles_to_digits_sse2(_mm_and_si128(block, _mm_set1_epi8(0x0f)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16), _mm_unpackhi_epi8(high, low));
+    }
+    encode_scalar(bytes + i, size - i, out + 2 * i);
+}
+
+__attribute__((target("sse2"))) inline void decode_sse2(const char *hex, size_t size, uint8_t *out)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        auto first = digits_to_bytes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i)));
+        auto second = digits_to_bytes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i + 16)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i / 2), _mm_packus_epi16(first, second));
+    }
+    decode_scalar(hex + i, size - i, out + i / 2);
+}
+
+// 0xff in every lane that holds a hex digit
+__attribute__((target("sse2"))) inline __m128i valid_digits_sse2(__m128i digits)
+{
+    auto digit = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+    auto letter = _mm_sub_epi8(_mm_or_si128(digits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    // unsigned x <= limit is min(x, limit) == x
+    auto is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    auto is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    return _mm_or_si128(is_digit, is_letter);
+}
+
+__attribute__((target("sse2"))) inline bool is_valid_sse2(const char *hex, size_t size)
+{
+    size_t i = 0;
+    auto valid = _mm_set1_epi8(-1);
+    for (; i + 16 <= size; i += 16)
+        valid = _mm_and_si128(valid, valid_digits_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i))));
+    return _mm_movemask_epi8(valid) == 0xffff && is_valid_scalar(hex + i, size - i);
+}
+
+__attribute__((target("avx2"))) inline __m256i nibbles_to_digits_avx2(__m256i nibbles)
+{
+    auto letters = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8('a' - '0' - 10));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letters);
+}
+
+__attribute__((target("avx2"))) inline __m256i digits_to_bytes_avx2(__m256i digits)
+{
+    auto lower = _mm256_or_si256(digits, _mm256_set1_epi8(0x20));
+    auto letters = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_set1_epi8('a' - '0' - 10));
+    auto nibbles = _mm256_sub_epi8(_mm256_sub_epi8(lower, _mm256_set1_epi8('0')), letters);
+    auto high = _mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x0f)), 4);
+    auto low = _mm256_and_si256(_mm256_srli_epi16(nibbles, 8), _mm256_set1_epi16(0x0f));
+    return _mm256_or_si256(high, low);
+}
+
+__attribute__((target("avx2"))) inline void encode_avx2(const uint8_t *bytes, size_t size, char *out)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i));
+        auto high = nibbles_to_digits_avx2(_mm256_and_si256(_mm256_srli_epi16(block, 4), _mm256_set1_epi8(0x0f)));
+        auto low = nibbles_to_digits_avx2(_mm256_and_si256(block, _mm256_set1_epi8(0x0f)));
+        // unpack works per 128-bit lane, so put the lanes back in order
+        auto first = _mm256_unpacklo_epi8(high, low);
+        auto second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    encode_sse2(bytes + i, size - i, out + 2 * i);
+}
+
+__attribute__((target("avx2"))) inline void decode_avx2(const char *hex, size_t size, uint8_t *out)
+{
+    size_t i = 0;
+    for (; i + 64 <= size; i += 64)
+    {
+        auto first = digits_to_bytes_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(hex + i)));
+        auto second = digits_to_bytes_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(hex + i + 32)));
+        // pack works per 128-bit lane as well
+        auto packed = _mm256_packus_epi16(first, second);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i / 2), _mm256_permute4x64_epi64(packed, 0xd8));
+    }
+    decode_sse2(hex + i, size - i, out + i / 2);
+}
+
+__attribute__((target("avx2"))) inline bool is_valid_avx2(const char *hex, size_t size)
+{
+    size_t i = 0;
+    auto valid = _mm256_set1_epi8(-1);
+    for (; i + 32 <= size; i += 32)
+    {
+        auto digits = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hex + i));
+        auto digit = _mm256_sub_epi8(digits, _mm256_set1_epi8('0'));
+        auto letter = _mm256_sub_epi8(_mm256_or_si256(digits, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        auto is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        auto is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+        valid = _mm256_and_si256(valid, _mm256_or_si256(is_digit, is_letter));
+    }
+    return _mm256_movemask_epi8(valid) == -1 && is_valid_sse2(hex + i, size - i);
+}
+
+#endif
+
+inline EncodeFunction select_encode()
+{
+#ifdef HEX_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return encode_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return encode_sse2;
+#endif
+    return encode_scalar;
+}
+
+inline DecodeFunction select_decode()
+{
+#ifdef HEX_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return decode_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return decode_sse2;
+#endif
+    return decode_scalar;
+}
+
+inline ValidateFunction select_is_valid()
+{
+#ifdef HEX_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return is_valid_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return is_valid_sse2;
+#endif
+    return is_valid_scalar;
+}
+
+inline void encode(const uint8_t *bytes, size_t size, char *out)
+{
+    static const EncodeFunction kernel = select_encode();
+    kernel(bytes, size, out);
+}
+
+inline void decode(const char *hex, size_t size, uint8_t *out)
+{
+    static const DecodeFunction kernel = select_decode();
+    kernel(hex, size, out);
+}
+
+// true when every character is a hex digit, of either case
+inline bool is_valid(const char *hex, size_t size)
+{
+    static const ValidateFunction kernel = select_is_valid();
+    return kernel(hex, size);
+}
+
+} // namespace hex
@@ -147,3 +147,20 @@ typedef struct
   HdsCrypto_UintBig m_UserAgreement; // set to Zero on 1st invocation
 
 } HdsCrypto_TxSenderParams;
+
+typedef struct
+{
+  HdsCrypto_UintBig m_Secret;
+  HdsCrypto_CompactPoint m_CoFactorG;
+  HdsCrypto_CompactPoint m_CoFactorJ;
+
+} HdsCrypto_KdfPub;
+
+typedef struct
+{
+  HdsCrypto_UintBig m_TauX;
+  HdsCrypto_CompactPoint m_T1;
+  HdsCrypto_CompactPoint m_T2;
+  uint8_t m_IsSuccessful;
+
+} HdsCrypto_RangeproofData;
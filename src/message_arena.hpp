@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <google/protobuf/arena.h>
+
+// Arena for the protobuf messages of one request or response. Its first
+// block lives inside the object, so a message tree that fits there never
+// touches the heap, and everything is freed at once when it goes out of
+// scope.
+class MessageArena
+{
+  public:
+    MessageArena() : m_arena(options(m_block, sizeof(m_block)))
+    {
+    }
+
+    MessageArena(const MessageArena &) = delete;            // disable copying
+    MessageArena &operator=(const MessageArena &) = delete; // disable assignment
+
+    // Messages generated without cc_enable_arenas are placed on the arena
+    // too, only their fields still come from the heap
+    template <typename T>
+    T *create()
+    {
+        return create<T>(std::integral_constant<bool, google::protobuf::Arena::is_arena_constructable<T>::value>());
+    }
+
+  private:
+    static constexpr size_t INITIAL_BLOCK_SIZE = 4096;
+
+    static google::protobuf::ArenaOptions options(char *block, size_t size)
+    {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block;
+        options.initial_block_size = size;
+        return options;
+    }
+
+    template <typename T>
+    T *create(std::true_type)
+    {
+        return google::protobuf::Arena::CreateMessage<T>(&m_arena);
+    }
+
+    template <typename T>
+    T *create(std::false_type)
+    {
+        return google::protobuf::Arena::Create<T>(&m_arena);
+    }
+
+    alignas(alignof(std::max_align_t)) char m_block[INITIAL_BLOCK_SIZE];
+    google::protobuf::Arena m_arena;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+// A request message taken from a pool of the calling thread and given back,
+// cleared, when it goes out of scope. Clear() keeps the capacity of the
+// strings and repeated fields, so once the pool is warm building a request
+// of the same shape does not allocate.
+template <typename T>
+class PooledMessage
+{
+  public:
+    PooledMessage() : m_message(take())
+    {
+    }
+
+    PooledMessage(const PooledMessage &) = delete;            // disable copying
+    PooledMessage &operator=(const PooledMessage &) = delete; // disable assignment
+
+    ~PooledMessage()
+    {
+        m_message->Clear();
+        pool().push_back(std::move(m_message));
+    }
+
+    T &operator*() const
+    {
+        return *m_message;
+    }
+
+    T *operator->() const
+    {
+        return m_message.get();
+    }
+
+  private:
+    // grows only as deep as pooled messages of one type get nested
+    static std::vector<std::unique_ptr<T>> &pool()
+    {
+        static thread_local std::vector<std::unique_ptr<T>> pool;
+        return pool;
+    }
+
+    static std::unique_ptr<T> take()
+    {
+        auto &free = pool();
+        if (free.empty())
+            return std::make_unique<T>();
+
+        auto message = std::move(free.back());
+        free.pop_back();
+        return message;
+    }
+
+    std::unique_ptr<T> m_message;
+};
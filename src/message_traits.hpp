@@ -0,0 +1,3005 @@
+// Generated by scripts/message_traits.py from messages.proto, do not edit.
+#pragma once
+
+#include <cstdint>
+
+namespace hw { namespace trezor { namespace messages { namespace binance {
+class BinanceGetAddress;
+class BinanceAddress;
+class BinanceGetPublicKey;
+class BinancePublicKey;
+class BinanceSignTx;
+class BinanceTxRequest;
+class BinanceTransferMsg;
+class BinanceOrderMsg;
+class BinanceCancelMsg;
+class BinanceSignedTx;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace bitcoin {
+class GetPublicKey;
+class PublicKey;
+class SignTx;
+class TxRequest;
+class TxAck;
+class GetAddress;
+class Address;
+class SignMessage;
+class VerifyMessage;
+class MessageSignature;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace bootloader {
+class FirmwareErase;
+class FirmwareUpload;
+class FirmwareRequest;
+class SelfTest;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace cardano {
+class CardanoSignTx;
+class CardanoTxRequest;
+class CardanoGetPublicKey;
+class CardanoPublicKey;
+class CardanoGetAddress;
+class CardanoAddress;
+class CardanoTxAck;
+class CardanoSignedTx;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace common {
+class Success;
+class Failure;
+class PinMatrixRequest;
+class PinMatrixAck;
+class ButtonRequest;
+class ButtonAck;
+class PassphraseRequest;
+class PassphraseAck;
+class PassphraseStateRequest;
+class PassphraseStateAck;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace crypto {
+class CipherKeyValue;
+class CipheredKeyValue;
+class SignIdentity;
+class SignedIdentity;
+class GetECDHSessionKey;
+class ECDHSessionKey;
+class CosiCommit;
+class CosiCommitment;
+class CosiSign;
+class CosiSignature;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace debug {
+class DebugLinkDecision;
+class DebugLinkGetState;
+class DebugLinkState;
+class DebugLinkStop;
+class DebugLinkLog;
+class DebugLinkMemoryRead;
+class DebugLinkMemory;
+class DebugLinkMemoryWrite;
+class DebugLinkFlashErase;
+class DebugLinkLayout;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace eos {
+class EosGetPublicKey;
+class EosPublicKey;
+class EosSignTx;
+class EosTxActionRequest;
+class EosTxActionAck;
+class EosSignedTx;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace ethereum {
+class EthereumGetPublicKey;
+class EthereumPublicKey;
+class EthereumGetAddress;
+class EthereumAddress;
+class EthereumSignTx;
+class EthereumTxRequest;
+class EthereumTxAck;
+class EthereumSignMessage;
+class EthereumVerifyMessage;
+class EthereumMessageSignature;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace hds {
+class HdsSignMessage;
+class HdsSignature;
+class HdsVerifyMessage;
+class HdsGetPublicKey;
+class HdsGetOwnerKey;
+class HdsOwnerKey;
+class HdsGenerateKey;
+class HdsGenerateNonce;
+class HdsECCPoint;
+class HdsGenerateRangeproof;
+class HdsRangeproofData;
+class HdsSignTransaction;
+class HdsSignedTransaction;
+class HdsGetNoncePublic;
+class HdsSignTransactionSend;
+class HdsSignTransactionSendResult;
+class HdsSignTransactionReceive;
+class HdsSignTransactionReceiveResult;
+class HdsSignTransactionSplit;
+class HdsSignTransactionSplitResult;
+class HdsGetNumSlots;
+class HdsNumSlots;
+class HdsGetPKdf;
+class HdsPKdf;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace lisk {
+class LiskGetAddress;
+class LiskAddress;
+class LiskSignTx;
+class LiskSignedTx;
+class LiskSignMessage;
+class LiskMessageSignature;
+class LiskVerifyMessage;
+class LiskGetPublicKey;
+class LiskPublicKey;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace management {
+class Initialize;
+class Ping;
+class ChangePin;
+class WipeDevice;
+class GetEntropy;
+class Entropy;
+class LoadDevice;
+class ResetDevice;
+class Features;
+class Cancel;
+class ClearSession;
+class ApplySettings;
+class ApplyFlags;
+class BackupDevice;
+class EntropyRequest;
+class EntropyAck;
+class RecoveryDevice;
+class WordRequest;
+class WordAck;
+class GetFeatures;
+class SetU2FCounter;
+class SdProtect;
+class GetNextU2FCounter;
+class NextU2FCounter;
+class ChangeWipeCode;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace monero {
+class MoneroTransactionInitRequest;
+class MoneroTransactionInitAck;
+class MoneroTransactionSetInputRequest;
+class MoneroTransactionSetInputAck;
+class MoneroTransactionInputsPermutationRequest;
+class MoneroTransactionInputsPermutationAck;
+class MoneroTransactionInputViniRequest;
+class MoneroTransactionInputViniAck;
+class MoneroTransactionAllInputsSetRequest;
+class MoneroTransactionAllInputsSetAck;
+class MoneroTransactionSetOutputRequest;
+class MoneroTransactionSetOutputAck;
+class MoneroTransactionAllOutSetRequest;
+class MoneroTransactionAllOutSetAck;
+class MoneroTransactionSignInputRequest;
+class MoneroTransactionSignInputAck;
+class MoneroTransactionFinalRequest;
+class MoneroTransactionFinalAck;
+class MoneroKeyImageExportInitRequest;
+class MoneroKeyImageExportInitAck;
+class MoneroKeyImageSyncStepRequest;
+class MoneroKeyImageSyncStepAck;
+class MoneroKeyImageSyncFinalRequest;
+class MoneroKeyImageSyncFinalAck;
+class MoneroGetAddress;
+class MoneroAddress;
+class MoneroGetWatchKey;
+class MoneroWatchKey;
+class DebugMoneroDiagRequest;
+class DebugMoneroDiagAck;
+class MoneroGetTxKeyRequest;
+class MoneroGetTxKeyAck;
+class MoneroLiveRefreshStartRequest;
+class MoneroLiveRefreshStartAck;
+class MoneroLiveRefreshStepRequest;
+class MoneroLiveRefreshStepAck;
+class MoneroLiveRefreshFinalRequest;
+class MoneroLiveRefreshFinalAck;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace nem {
+class NEMGetAddress;
+class NEMAddress;
+class NEMSignTx;
+class NEMSignedTx;
+class NEMDecryptMessage;
+class NEMDecryptedMessage;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace ripple {
+class RippleGetAddress;
+class RippleAddress;
+class RippleSignTx;
+class RippleSignedTx;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace stellar {
+class StellarSignTx;
+class StellarTxOpRequest;
+class StellarGetAddress;
+class StellarAddress;
+class StellarCreateAccountOp;
+class StellarPaymentOp;
+class StellarPathPaymentOp;
+class StellarManageOfferOp;
+class StellarCreatePassiveOfferOp;
+class StellarSetOptionsOp;
+class StellarChangeTrustOp;
+class StellarAllowTrustOp;
+class StellarAccountMergeOp;
+class StellarManageDataOp;
+class StellarBumpSequenceOp;
+class StellarSignedTx;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace tezos {
+class TezosGetAddress;
+class TezosAddress;
+class TezosSignTx;
+class TezosSignedTx;
+class TezosGetPublicKey;
+class TezosPublicKey;
+}}}}
+namespace hw { namespace trezor { namespace messages { namespace webauthn {
+class WebAuthnListResidentCredentials;
+class WebAuthnCredentials;
+class WebAuthnAddResidentCredential;
+class WebAuthnRemoveResidentCredential;
+}}}}
+
+template <typename T>
+struct message_traits
+{
+    static constexpr bool is_message = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::Initialize>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 0;
+    static constexpr const char *name = "Initialize";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::Ping>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 1;
+    static constexpr const char *name = "Ping";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::Success>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 2;
+    static constexpr const char *name = "Success";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::Failure>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 3;
+    static constexpr const char *name = "Failure";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ChangePin>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 4;
+    static constexpr const char *name = "ChangePin";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::WipeDevice>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 5;
+    static constexpr const char *name = "WipeDevice";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::GetEntropy>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 9;
+    static constexpr const char *name = "GetEntropy";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::Entropy>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 10;
+    static constexpr const char *name = "Entropy";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::LoadDevice>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 13;
+    static constexpr const char *name = "LoadDevice";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ResetDevice>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 14;
+    static constexpr const char *name = "ResetDevice";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::Features>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 17;
+    static constexpr const char *name = "Features";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PinMatrixRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 18;
+    static constexpr const char *name = "PinMatrixRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PinMatrixAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 19;
+    static constexpr const char *name = "PinMatrixAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::Cancel>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 20;
+    static constexpr const char *name = "Cancel";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ClearSession>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 24;
+    static constexpr const char *name = "ClearSession";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ApplySettings>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 25;
+    static constexpr const char *name = "ApplySettings";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::ButtonRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 26;
+    static constexpr const char *name = "ButtonRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::ButtonAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 27;
+    static constexpr const char *name = "ButtonAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ApplyFlags>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 28;
+    static constexpr const char *name = "ApplyFlags";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::BackupDevice>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 34;
+    static constexpr const char *name = "BackupDevice";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::EntropyRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 35;
+    static constexpr const char *name = "EntropyRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::EntropyAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 36;
+    static constexpr const char *name = "EntropyAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PassphraseRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 41;
+    static constexpr const char *name = "PassphraseRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PassphraseAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 42;
+    static constexpr const char *name = "PassphraseAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PassphraseStateRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 77;
+    static constexpr const char *name = "PassphraseStateRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::common::PassphraseStateAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 78;
+    static constexpr const char *name = "PassphraseStateAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::RecoveryDevice>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 45;
+    static constexpr const char *name = "RecoveryDevice";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::WordRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 46;
+    static constexpr const char *name = "WordRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::WordAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 47;
+    static constexpr const char *name = "WordAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::GetFeatures>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 55;
+    static constexpr const char *name = "GetFeatures";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::SetU2FCounter>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 63;
+    static constexpr const char *name = "SetU2FCounter";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::SdProtect>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 79;
+    static constexpr const char *name = "SdProtect";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::GetNextU2FCounter>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 80;
+    static constexpr const char *name = "GetNextU2FCounter";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::NextU2FCounter>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 81;
+    static constexpr const char *name = "NextU2FCounter";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::management::ChangeWipeCode>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 82;
+    static constexpr const char *name = "ChangeWipeCode";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bootloader::FirmwareErase>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 6;
+    static constexpr const char *name = "FirmwareErase";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bootloader::FirmwareUpload>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 7;
+    static constexpr const char *name = "FirmwareUpload";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bootloader::FirmwareRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 8;
+    static constexpr const char *name = "FirmwareRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bootloader::SelfTest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 32;
+    static constexpr const char *name = "SelfTest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::GetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 11;
+    static constexpr const char *name = "GetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::PublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 12;
+    static constexpr const char *name = "PublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::SignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 15;
+    static constexpr const char *name = "SignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::TxRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 21;
+    static constexpr const char *name = "TxRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::TxAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 22;
+    static constexpr const char *name = "TxAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::GetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 29;
+    static constexpr const char *name = "GetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::Address>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 30;
+    static constexpr const char *name = "Address";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::SignMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 38;
+    static constexpr const char *name = "SignMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::VerifyMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 39;
+    static constexpr const char *name = "VerifyMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::bitcoin::MessageSignature>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 40;
+    static constexpr const char *name = "MessageSignature";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CipherKeyValue>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 23;
+    static constexpr const char *name = "CipherKeyValue";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CipheredKeyValue>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 48;
+    static constexpr const char *name = "CipheredKeyValue";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::SignIdentity>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 53;
+    static constexpr const char *name = "SignIdentity";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::SignedIdentity>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 54;
+    static constexpr const char *name = "SignedIdentity";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::GetECDHSessionKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 61;
+    static constexpr const char *name = "GetECDHSessionKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::ECDHSessionKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 62;
+    static constexpr const char *name = "ECDHSessionKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CosiCommit>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 71;
+    static constexpr const char *name = "CosiCommit";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CosiCommitment>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 72;
+    static constexpr const char *name = "CosiCommitment";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CosiSign>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 73;
+    static constexpr const char *name = "CosiSign";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::crypto::CosiSignature>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 74;
+    static constexpr const char *name = "CosiSignature";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkDecision>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 100;
+    static constexpr const char *name = "DebugLinkDecision";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkGetState>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 101;
+    static constexpr const char *name = "DebugLinkGetState";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkState>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 102;
+    static constexpr const char *name = "DebugLinkState";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkStop>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 103;
+    static constexpr const char *name = "DebugLinkStop";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkLog>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 104;
+    static constexpr const char *name = "DebugLinkLog";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkMemoryRead>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 110;
+    static constexpr const char *name = "DebugLinkMemoryRead";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkMemory>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 111;
+    static constexpr const char *name = "DebugLinkMemory";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkMemoryWrite>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 112;
+    static constexpr const char *name = "DebugLinkMemoryWrite";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkFlashErase>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 113;
+    static constexpr const char *name = "DebugLinkFlashErase";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::debug::DebugLinkLayout>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 9001;
+    static constexpr const char *name = "DebugLinkLayout";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 450;
+    static constexpr const char *name = "EthereumGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 451;
+    static constexpr const char *name = "EthereumPublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 56;
+    static constexpr const char *name = "EthereumGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 57;
+    static constexpr const char *name = "EthereumAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 58;
+    static constexpr const char *name = "EthereumSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumTxRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 59;
+    static constexpr const char *name = "EthereumTxRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumTxAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 60;
+    static constexpr const char *name = "EthereumTxAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumSignMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 64;
+    static constexpr const char *name = "EthereumSignMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumVerifyMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 65;
+    static constexpr const char *name = "EthereumVerifyMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ethereum::EthereumMessageSignature>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 66;
+    static constexpr const char *name = "EthereumMessageSignature";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 67;
+    static constexpr const char *name = "NEMGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 68;
+    static constexpr const char *name = "NEMAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 69;
+    static constexpr const char *name = "NEMSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 70;
+    static constexpr const char *name = "NEMSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMDecryptMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 75;
+    static constexpr const char *name = "NEMDecryptMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::nem::NEMDecryptedMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 76;
+    static constexpr const char *name = "NEMDecryptedMessage";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 114;
+    static constexpr const char *name = "LiskGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 115;
+    static constexpr const char *name = "LiskAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 116;
+    static constexpr const char *name = "LiskSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 117;
+    static constexpr const char *name = "LiskSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskSignMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 118;
+    static constexpr const char *name = "LiskSignMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskMessageSignature>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 119;
+    static constexpr const char *name = "LiskMessageSignature";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskVerifyMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 120;
+    static constexpr const char *name = "LiskVerifyMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 121;
+    static constexpr const char *name = "LiskGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::lisk::LiskPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 122;
+    static constexpr const char *name = "LiskPublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 150;
+    static constexpr const char *name = "TezosGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 151;
+    static constexpr const char *name = "TezosAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 152;
+    static constexpr const char *name = "TezosSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 153;
+    static constexpr const char *name = "TezosSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 154;
+    static constexpr const char *name = "TezosGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::tezos::TezosPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 155;
+    static constexpr const char *name = "TezosPublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 202;
+    static constexpr const char *name = "StellarSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarTxOpRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 203;
+    static constexpr const char *name = "StellarTxOpRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 207;
+    static constexpr const char *name = "StellarGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 208;
+    static constexpr const char *name = "StellarAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarCreateAccountOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 210;
+    static constexpr const char *name = "StellarCreateAccountOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarPaymentOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 211;
+    static constexpr const char *name = "StellarPaymentOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarPathPaymentOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 212;
+    static constexpr const char *name = "StellarPathPaymentOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarManageOfferOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 213;
+    static constexpr const char *name = "StellarManageOfferOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarCreatePassiveOfferOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 214;
+    static constexpr const char *name = "StellarCreatePassiveOfferOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarSetOptionsOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 215;
+    static constexpr const char *name = "StellarSetOptionsOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarChangeTrustOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 216;
+    static constexpr const char *name = "StellarChangeTrustOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarAllowTrustOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 217;
+    static constexpr const char *name = "StellarAllowTrustOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarAccountMergeOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 218;
+    static constexpr const char *name = "StellarAccountMergeOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarManageDataOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 220;
+    static constexpr const char *name = "StellarManageDataOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarBumpSequenceOp>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 221;
+    static constexpr const char *name = "StellarBumpSequenceOp";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::stellar::StellarSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 230;
+    static constexpr const char *name = "StellarSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 303;
+    static constexpr const char *name = "CardanoSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoTxRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 304;
+    static constexpr const char *name = "CardanoTxRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 305;
+    static constexpr const char *name = "CardanoGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 306;
+    static constexpr const char *name = "CardanoPublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 307;
+    static constexpr const char *name = "CardanoGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 308;
+    static constexpr const char *name = "CardanoAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoTxAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 309;
+    static constexpr const char *name = "CardanoTxAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::cardano::CardanoSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 310;
+    static constexpr const char *name = "CardanoSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ripple::RippleGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 400;
+    static constexpr const char *name = "RippleGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ripple::RippleAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 401;
+    static constexpr const char *name = "RippleAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ripple::RippleSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 402;
+    static constexpr const char *name = "RippleSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::ripple::RippleSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 403;
+    static constexpr const char *name = "RippleSignedTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInitRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 501;
+    static constexpr const char *name = "MoneroTransactionInitRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInitAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 502;
+    static constexpr const char *name = "MoneroTransactionInitAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSetInputRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 503;
+    static constexpr const char *name = "MoneroTransactionSetInputRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSetInputAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 504;
+    static constexpr const char *name = "MoneroTransactionSetInputAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInputsPermutationRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 505;
+    static constexpr const char *name = "MoneroTransactionInputsPermutationRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInputsPermutationAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 506;
+    static constexpr const char *name = "MoneroTransactionInputsPermutationAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInputViniRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 507;
+    static constexpr const char *name = "MoneroTransactionInputViniRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionInputViniAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 508;
+    static constexpr const char *name = "MoneroTransactionInputViniAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionAllInputsSetRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 509;
+    static constexpr const char *name = "MoneroTransactionAllInputsSetRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionAllInputsSetAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 510;
+    static constexpr const char *name = "MoneroTransactionAllInputsSetAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSetOutputRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 511;
+    static constexpr const char *name = "MoneroTransactionSetOutputRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSetOutputAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 512;
+    static constexpr const char *name = "MoneroTransactionSetOutputAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionAllOutSetRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 513;
+    static constexpr const char *name = "MoneroTransactionAllOutSetRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionAllOutSetAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 514;
+    static constexpr const char *name = "MoneroTransactionAllOutSetAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSignInputRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 515;
+    static constexpr const char *name = "MoneroTransactionSignInputRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionSignInputAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 516;
+    static constexpr const char *name = "MoneroTransactionSignInputAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionFinalRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 517;
+    static constexpr const char *name = "MoneroTransactionFinalRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroTransactionFinalAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 518;
+    static constexpr const char *name = "MoneroTransactionFinalAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageExportInitRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 530;
+    static constexpr const char *name = "MoneroKeyImageExportInitRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageExportInitAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 531;
+    static constexpr const char *name = "MoneroKeyImageExportInitAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageSyncStepRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 532;
+    static constexpr const char *name = "MoneroKeyImageSyncStepRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageSyncStepAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 533;
+    static constexpr const char *name = "MoneroKeyImageSyncStepAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageSyncFinalRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 534;
+    static constexpr const char *name = "MoneroKeyImageSyncFinalRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroKeyImageSyncFinalAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 535;
+    static constexpr const char *name = "MoneroKeyImageSyncFinalAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 540;
+    static constexpr const char *name = "MoneroGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 541;
+    static constexpr const char *name = "MoneroAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroGetWatchKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 542;
+    static constexpr const char *name = "MoneroGetWatchKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroWatchKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 543;
+    static constexpr const char *name = "MoneroWatchKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::DebugMoneroDiagRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 546;
+    static constexpr const char *name = "DebugMoneroDiagRequest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::DebugMoneroDiagAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 547;
+    static constexpr const char *name = "DebugMoneroDiagAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroGetTxKeyRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 550;
+    static constexpr const char *name = "MoneroGetTxKeyRequest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroGetTxKeyAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 551;
+    static constexpr const char *name = "MoneroGetTxKeyAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshStartRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 552;
+    static constexpr const char *name = "MoneroLiveRefreshStartRequest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshStartAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 553;
+    static constexpr const char *name = "MoneroLiveRefreshStartAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshStepRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 554;
+    static constexpr const char *name = "MoneroLiveRefreshStepRequest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshStepAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 555;
+    static constexpr const char *name = "MoneroLiveRefreshStepAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshFinalRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 556;
+    static constexpr const char *name = "MoneroLiveRefreshFinalRequest";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::monero::MoneroLiveRefreshFinalAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 557;
+    static constexpr const char *name = "MoneroLiveRefreshFinalAck";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 600;
+    static constexpr const char *name = "EosGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 601;
+    static constexpr const char *name = "EosPublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 602;
+    static constexpr const char *name = "EosSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosTxActionRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 603;
+    static constexpr const char *name = "EosTxActionRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosTxActionAck>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 604;
+    static constexpr const char *name = "EosTxActionAck";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::eos::EosSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 605;
+    static constexpr const char *name = "EosSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceGetAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 700;
+    static constexpr const char *name = "BinanceGetAddress";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceAddress>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 701;
+    static constexpr const char *name = "BinanceAddress";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 702;
+    static constexpr const char *name = "BinanceGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinancePublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 703;
+    static constexpr const char *name = "BinancePublicKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceSignTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 704;
+    static constexpr const char *name = "BinanceSignTx";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceTxRequest>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 705;
+    static constexpr const char *name = "BinanceTxRequest";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceTransferMsg>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 706;
+    static constexpr const char *name = "BinanceTransferMsg";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceOrderMsg>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 707;
+    static constexpr const char *name = "BinanceOrderMsg";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceCancelMsg>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 708;
+    static constexpr const char *name = "BinanceCancelMsg";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::binance::BinanceSignedTx>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 709;
+    static constexpr const char *name = "BinanceSignedTx";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::webauthn::WebAuthnListResidentCredentials>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 800;
+    static constexpr const char *name = "WebAuthnListResidentCredentials";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::webauthn::WebAuthnCredentials>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 801;
+    static constexpr const char *name = "WebAuthnCredentials";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::webauthn::WebAuthnAddResidentCredential>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 802;
+    static constexpr const char *name = "WebAuthnAddResidentCredential";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::webauthn::WebAuthnRemoveResidentCredential>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 803;
+    static constexpr const char *name = "WebAuthnRemoveResidentCredential";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 902;
+    static constexpr const char *name = "HdsSignMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignature>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 903;
+    static constexpr const char *name = "HdsSignature";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsVerifyMessage>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 904;
+    static constexpr const char *name = "HdsVerifyMessage";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGetPublicKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 905;
+    static constexpr const char *name = "HdsGetPublicKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGetOwnerKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 907;
+    static constexpr const char *name = "HdsGetOwnerKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsOwnerKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 908;
+    static constexpr const char *name = "HdsOwnerKey";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGenerateKey>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 909;
+    static constexpr const char *name = "HdsGenerateKey";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGenerateNonce>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 910;
+    static constexpr const char *name = "HdsGenerateNonce";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsECCPoint>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 911;
+    static constexpr const char *name = "HdsECCPoint";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGenerateRangeproof>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 912;
+    static constexpr const char *name = "HdsGenerateRangeproof";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsRangeproofData>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 913;
+    static constexpr const char *name = "HdsRangeproofData";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransaction>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 914;
+    static constexpr const char *name = "HdsSignTransaction";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignedTransaction>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 915;
+    static constexpr const char *name = "HdsSignedTransaction";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGetNoncePublic>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 916;
+    static constexpr const char *name = "HdsGetNoncePublic";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionSend>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 917;
+    static constexpr const char *name = "HdsSignTransactionSend";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionSendResult>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 918;
+    static constexpr const char *name = "HdsSignTransactionSendResult";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionReceive>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 919;
+    static constexpr const char *name = "HdsSignTransactionReceive";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionReceiveResult>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 920;
+    static constexpr const char *name = "HdsSignTransactionReceiveResult";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionSplit>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 921;
+    static constexpr const char *name = "HdsSignTransactionSplit";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsSignTransactionSplitResult>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 922;
+    static constexpr const char *name = "HdsSignTransactionSplitResult";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGetNumSlots>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 923;
+    static constexpr const char *name = "HdsGetNumSlots";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsNumSlots>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 924;
+    static constexpr const char *name = "HdsNumSlots";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsGetPKdf>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 925;
+    static constexpr const char *name = "HdsGetPKdf";
+    static constexpr bool wire_in = true;
+    static constexpr bool wire_out = false;
+};
+
+template <>
+struct message_traits<hw::trezor::messages::hds::HdsPKdf>
+{
+    static constexpr bool is_message = true;
+    static constexpr uint16_t id = 926;
+    static constexpr const char *name = "HdsPKdf";
+    static constexpr bool wire_in = false;
+    static constexpr bool wire_out = true;
+};
+
+constexpr const char *message_type_name(int type)
+{
+    switch (type)
+    {
+    case 0:
+        return "Initialize";
+    case 1:
+        return "Ping";
+    case 2:
+        return "Success";
+    case 3:
+        return "Failure";
+    case 4:
+        return "ChangePin";
+    case 5:
+        return "WipeDevice";
+    case 6:
+        return "FirmwareErase";
+    case 7:
+        return "FirmwareUpload";
+    case 8:
+        return "FirmwareRequest";
+    case 9:
+        return "GetEntropy";
+    case 10:
+        return "Entropy";
+    case 11:
+        return "GetPublicKey";
+    case 12:
+        return "PublicKey";
+    case 13:
+        return "LoadDevice";
+    case 14:
+        return "ResetDevice";
+    case 15:
+        return "SignTx";
+    case 17:
+        return "Features";
+    case 18:
+        return "PinMatrixRequest";
+    case 19:
+        return "PinMatrixAck";
+    case 20:
+        return "Cancel";
+    case 21:
+        return "TxRequest";
+    case 22:
+        return "TxAck";
+    case 23:
+        return "CipherKeyValue";
+    case 24:
+        return "ClearSession";
+    case 25:
+        return "ApplySettings";
+    case 26:
+        return "ButtonRequest";
+    case 27:
+        return "ButtonAck";
+    case 28:
+        return "ApplyFlags";
+    case 29:
+        return "GetAddress";
+    case 30:
+        return "Address";
+    case 32:
+        return "SelfTest";
+    case 34:
+        return "BackupDevice";
+    case 35:
+        return "EntropyRequest";
+    case 36:
+        return "EntropyAck";
+    case 38:
+        return "SignMessage";
+    case 39:
+        return "VerifyMessage";
+    case 40:
+        return "MessageSignature";
+    case 41:
+        return "PassphraseRequest";
+    case 42:
+        return "PassphraseAck";
+    case 45:
+        return "RecoveryDevice";
+    case 46:
+        return "WordRequest";
+    case 47:
+        return "WordAck";
+    case 48:
+        return "CipheredKeyValue";
+    case 53:
+        return "SignIdentity";
+    case 54:
+        return "SignedIdentity";
+    case 55:
+        return "GetFeatures";
+    case 56:
+        return "EthereumGetAddress";
+    case 57:
+        return "EthereumAddress";
+    case 58:
+        return "EthereumSignTx";
+    case 59:
+        return "EthereumTxRequest";
+    case 60:
+        return "EthereumTxAck";
+    case 61:
+        return "GetECDHSessionKey";
+    case 62:
+        return "ECDHSessionKey";
+    case 63:
+        return "SetU2FCounter";
+    case 64:
+        return "EthereumSignMessage";
+    case 65:
+        return "EthereumVerifyMessage";
+    case 66:
+        return "EthereumMessageSignature";
+    case 67:
+        return "NEMGetAddress";
+    case 68:
+        return "NEMAddress";
+    case 69:
+        return "NEMSignTx";
+    case 70:
+        return "NEMSignedTx";
+    case 71:
+        return "CosiCommit";
+    case 72:
+        return "CosiCommitment";
+    case 73:
+        return "CosiSign";
+    case 74:
+        return "CosiSignature";
+    case 75:
+        return "NEMDecryptMessage";
+    case 76:
+        return "NEMDecryptedMessage";
+    case 77:
+        return "PassphraseStateRequest";
+    case 78:
+        return "PassphraseStateAck";
+    case 79:
+        return "SdProtect";
+    case 80:
+        return "GetNextU2FCounter";
+    case 81:
+        return "NextU2FCounter";
+    case 82:
+        return "ChangeWipeCode";
+    case 100:
+        return "DebugLinkDecision";
+    case 101:
+        return "DebugLinkGetState";
+    case 102:
+        return "DebugLinkState";
+    case 103:
+        return "DebugLinkStop";
+    case 104:
+        return "DebugLinkLog";
+    case 110:
+        return "DebugLinkMemoryRead";
+    case 111:
+        return "DebugLinkMemory";
+    case 112:
+        return "DebugLinkMemoryWrite";
+    case 113:
+        return "DebugLinkFlashErase";
+    case 114:
+        return "LiskGetAddress";
+    case 115:
+        return "LiskAddress";
+    case 116:
+        return "LiskSignTx";
+    case 117:
+        return "LiskSignedTx";
+    case 118:
+        return "LiskSignMessage";
+    case 119:
+        return "LiskMessageSignature";
+    case 120:
+        return "LiskVerifyMessage";
+    case 121:
+        return "LiskGetPublicKey";
+    case 122:
+        return "LiskPublicKey";
+    case 150:
+        return "TezosGetAddress";
+    case 151:
+        return "TezosAddress";
+    case 152:
+        return "TezosSignTx";
+    case 153:
+        return "TezosSignedTx";
+    case 154:
+        return "TezosGetPublicKey";
+    case 155:
+        return "TezosPublicKey";
+    case 202:
+        return "StellarSignTx";
+    case 203:
+        return "StellarTxOpRequest";
+    case 207:
+        return "StellarGetAddress";
+    case 208:
+        return "StellarAddress";
+    case 210:
+        return "StellarCreateAccountOp";
+    case 211:
+        return "StellarPaymentOp";
+    case 212:
+        return "StellarPathPaymentOp";
+    case 213:
+        return "StellarManageOfferOp";
+    case 214:
+        return "StellarCreatePassiveOfferOp";
+    case 215:
+        return "StellarSetOptionsOp";
+    case 216:
+        return "StellarChangeTrustOp";
+    case 217:
+        return "StellarAllowTrustOp";
+    case 218:
+        return "StellarAccountMergeOp";
+    case 220:
+        return "StellarManageDataOp";
+    case 221:
+        return "StellarBumpSequenceOp";
+    case 230:
+        return "StellarSignedTx";
+    case 303:
+        return "CardanoSignTx";
+    case 304:
+        return "CardanoTxRequest";
+    case 305:
+        return "CardanoGetPublicKey";
+    case 306:
+        return "CardanoPublicKey";
+    case 307:
+        return "CardanoGetAddress";
+    case 308:
+        return "CardanoAddress";
+    case 309:
+        return "CardanoTxAck";
+    case 310:
+        return "CardanoSignedTx";
+    case 400:
+        return "RippleGetAddress";
+    case 401:
+        return "RippleAddress";
+    case 402:
+        return "RippleSignTx";
+    case 403:
+        return "RippleSignedTx";
+    case 450:
+        return "EthereumGetPublicKey";
+    case 451:
+        return "EthereumPublicKey";
+    case 501:
+        return "MoneroTransactionInitRequest";
+    case 502:
+        return "MoneroTransactionInitAck";
+    case 503:
+        return "MoneroTransactionSetInputRequest";
+    case 504:
+        return "MoneroTransactionSetInputAck";
+    case 505:
+        return "MoneroTransactionInputsPermutationRequest";
+    case 506:
+        return "MoneroTransactionInputsPermutationAck";
+    case 507:
+        return "MoneroTransactionInputViniRequest";
+    case 508:
+        return "MoneroTransactionInputViniAck";
+    case 509:
+        return "MoneroTransactionAllInputsSetRequest";
+    case 510:
+        return "MoneroTransactionAllInputsSetAck";
+    case 511:
+        return "MoneroTransactionSetOutputRequest";
+    case 512:
+        return "MoneroTransactionSetOutputAck";
+    case 513:
+        return "MoneroTransactionAllOutSetRequest";
+    case 514:
+        return "MoneroTransactionAllOutSetAck";
+    case 515:
+        return "MoneroTransactionSignInputRequest";
+    case 516:
+        return "MoneroTransactionSignInputAck";
+    case 517:
+        return "MoneroTransactionFinalRequest";
+    case 518:
+        return "MoneroTransactionFinalAck";
+    case 530:
+        return "MoneroKeyImageExportInitRequest";
+    case 531:
+        return "MoneroKeyImageExportInitAck";
+    case 532:
+        return "MoneroKeyImageSyncStepRequest";
+    case 533:
+        return "MoneroKeyImageSyncStepAck";
+    case 534:
+        return "MoneroKeyImageSyncFinalRequest";
+    case 535:
+        return "MoneroKeyImageSyncFinalAck";
+    case 540:
+        return "MoneroGetAddress";
+    case 541:
+        return "MoneroAddress";
+    case 542:
+        return "MoneroGetWatchKey";
+    case 543:
+        return "MoneroWatchKey";
+    case 546:
+        return "DebugMoneroDiagRequest";
+    case 547:
+        return "DebugMoneroDiagAck";
+    case 550:
+        return "MoneroGetTxKeyRequest";
+    case 551:
+        return "MoneroGetTxKeyAck";
+    case 552:
+        return "MoneroLiveRefreshStartRequest";
+    case 553:
+        return "MoneroLiveRefreshStartAck";
+    case 554:
+        return "MoneroLiveRefreshStepRequest";
+    case 555:
+        return "MoneroLiveRefreshStepAck";
+    case 556:
+        return "MoneroLiveRefreshFinalRequest";
+    case 557:
+        return "MoneroLiveRefreshFinalAck";
+    case 600:
+        return "EosGetPublicKey";
+    case 601:
+        return "EosPublicKey";
+    case 602:
+        return "EosSignTx";
+    case 603:
+        return "EosTxActionRequest";
+    case 604:
+        return "EosTxActionAck";
+    case 605:
+        return "EosSignedTx";
+    case 700:
+        return "BinanceGetAddress";
+    case 701:
+        return "BinanceAddress";
+    case 702:
+        return "BinanceGetPublicKey";
+    case 703:
+        return "BinancePublicKey";
+    case 704:
+        return "BinanceSignTx";
+    case 705:
+        return "BinanceTxRequest";
+    case 706:
+        return "BinanceTransferMsg";
+    case 707:
+        return "BinanceOrderMsg";
+    case 708:
+        return "BinanceCancelMsg";
+    case 709:
+        return "BinanceSignedTx";
+    case 800:
+        return "WebAuthnListResidentCredentials";
+    case 801:
+        return "WebAuthnCredentials";
+    case 802:
+        return "WebAuthnAddResidentCredential";
+    case 803:
+        return "WebAuthnRemoveResidentCredential";
+    case 902:
+        return "HdsSignMessage";
+    case 903:
+        return "HdsSignature";
+    case 904:
+        return "HdsVerifyMessage";
+    case 905:
+        return "HdsGetPublicKey";
+    case 907:
+        return "HdsGetOwnerKey";
+    case 908:
+        return "HdsOwnerKey";
+    case 909:
+        return "HdsGenerateKey";
+    case 910:
+        return "HdsGenerateNonce";
+    case 911:
+        return "HdsECCPoint";
+    case 912:
+        return "HdsGenerateRangeproof";
+    case 913:
+        return "HdsRangeproofData";
+    case 914:
+        return "HdsSignTransaction";
+    case 915:
+        return "HdsSignedTransaction";
+    case 916:
+        return "HdsGetNoncePublic";
+    case 917:
+        return "HdsSignTransactionSend";
+    case 918:
+        return "HdsSignTransactionSendResult";
+    case 919:
+        return "HdsSignTransactionReceive";
+    case 920:
+        return "HdsSignTransactionReceiveResult";
+    case 921:
+        return "HdsSignTransactionSplit";
+    case 922:
+        return "HdsSignTransactionSplitResult";
+    case 923:
+        return "HdsGetNumSlots";
+    case 924:
+        return "HdsNumSlots";
+    case 925:
+        return "HdsGetPKdf";
+    case 926:
+        return "HdsPKdf";
+    case 9001:
+        return "DebugLinkLayout";
+    default:
+        return nullptr;
+    }
+}
+
+struct message_type_entry
+{
+    const char *name;
+    uint16_t id;
+};
+
+constexpr message_type_entry message_types[] = {
+    {"Initialize", 0},
+    {"Ping", 1},
+    {"Success", 2},
+    {"Failure", 3},
+    {"ChangePin", 4},
+    {"WipeDevice", 5},
+    {"GetEntropy", 9},
+    {"Entropy", 10},
+    {"LoadDevice", 13},
+    {"ResetDevice", 14},
+    {"Features", 17},
+    {"PinMatrixRequest", 18},
+    {"PinMatrixAck", 19},
+    {"Cancel", 20},
+    {"ClearSession", 24},
+    {"ApplySettings", 25},
+    {"ButtonRequest", 26},
+    {"ButtonAck", 27},
+    {"ApplyFlags", 28},
+    {"BackupDevice", 34},
+    {"EntropyRequest", 35},
+    {"EntropyAck", 36},
+    {"PassphraseRequest", 41},
+    {"PassphraseAck", 42},
+    {"PassphraseStateRequest", 77},
+    {"PassphraseStateAck", 78},
+    {"RecoveryDevice", 45},
+    {"WordRequest", 46},
+    {"WordAck", 47},
+    {"GetFeatures", 55},
+    {"SetU2FCounter", 63},
+    {"SdProtect", 79},
+    {"GetNextU2FCounter", 80},
+    {"NextU2FCounter", 81},
+    {"ChangeWipeCode", 82},
+    {"FirmwareErase", 6},
+    {"FirmwareUpload", 7},
+    {"FirmwareRequest", 8},
+    {"SelfTest", 32},
+    {"GetPublicKey", 11},
+    {"PublicKey", 12},
+    {"SignTx", 15},
+    {"TxRequest", 21},
+    {"TxAck", 22},
+    {"GetAddress", 29},
+    {"Address", 30},
+    {"SignMessage", 38},
+    {"VerifyMessage", 39},
+    {"MessageSignature", 40},
+    {"CipherKeyValue", 23},
+    {"CipheredKeyValue", 48},
+    {"SignIdentity", 53},
+    {"SignedIdentity", 54},
+    {"GetECDHSessionKey", 61},
+    {"ECDHSessionKey", 62},
+    {"CosiCommit", 71},
+    {"CosiCommitment", 72},
+    {"CosiSign", 73},
+    {"CosiSignature", 74},
+    {"DebugLinkDecision", 100},
+    {"DebugLinkGetState", 101},
+    {"DebugLinkState", 102},
+    {"DebugLinkStop", 103},
+    {"DebugLinkLog", 104},
+    {"DebugLinkMemoryRead", 110},
+    {"DebugLinkMemory", 111},
+    {"DebugLinkMemoryWrite", 112},
+    {"DebugLinkFlashErase", 113},
+    {"DebugLinkLayout", 9001},
+    {"EthereumGetPublicKey", 450},
+    {"EthereumPublicKey", 451},
+    {"EthereumGetAddress", 56},
+    {"EthereumAddress", 57},
+    {"EthereumSignTx", 58},
+    {"EthereumTxRequest", 59},
+    {"EthereumTxAck", 60},
+    {"EthereumSignMessage", 64},
+    {"EthereumVerifyMessage", 65},
+    {"EthereumMessageSignature", 66},
+    {"NEMGetAddress", 67},
+    {"NEMAddress", 68},
+    {"NEMSignTx", 69},
+    {"NEMSignedTx", 70},
+    {"NEMDecryptMessage", 75},
+    {"NEMDecryptedMessage", 76},
+    {"LiskGetAddress", 114},
+    {"LiskAddress", 115},
+    {"LiskSignTx", 116},
+    {"LiskSignedTx", 117},
+    {"LiskSignMessage", 118},
+    {"LiskMessageSignature", 119},
+    {"LiskVerifyMessage", 120},
+    {"LiskGetPublicKey", 121},
+    {"LiskPublicKey", 122},
+    {"TezosGetAddress", 150},
+    {"TezosAddress", 151},
+    {"TezosSignTx", 152},
+    {"TezosSignedTx", 153},
+    {"TezosGetPublicKey", 154},
+    {"TezosPublicKey", 155},
+    {"StellarSignTx", 202},
+    {"StellarTxOpRequest", 203},
+    {"StellarGetAddress", 207},
+    {"StellarAddress", 208},
+    {"StellarCreateAccountOp", 210},
+    {"StellarPaymentOp", 211},
+    {"StellarPathPaymentOp", 212},
+    {"StellarManageOfferOp", 213},
+    {"StellarCreatePassiveOfferOp", 214},
+    {"StellarSetOptionsOp", 215},
+    {"StellarChangeTrustOp", 216},
+    {"StellarAllowTrustOp", 217},
+    {"StellarAccountMergeOp", 218},
+    {"StellarManageDataOp", 220},
+    {"StellarBumpSequenceOp", 221},
+    {"StellarSignedTx", 230},
+    {"CardanoSignTx", 303},
+    {"CardanoTxRequest", 304},
+    {"CardanoGetPublicKey", 305},
+    {"CardanoPublicKey", 306},
+    {"CardanoGetAddress", 307},
+    {"CardanoAddress", 308},
+    {"CardanoTxAck", 309},
+    {"CardanoSignedTx", 310},
+    {"RippleGetAddress", 400},
+    {"RippleAddress", 401},
+    {"RippleSignTx", 402},
+    {"RippleSignedTx", 403},
+    {"MoneroTransactionInitRequest", 501},
+    {"MoneroTransactionInitAck", 502},
+    {"MoneroTransactionSetInputRequest", 503},
+    {"MoneroTransactionSetInputAck", 504},
+    {"MoneroTransactionInputsPermutationRequest", 505},
+    {"MoneroTransactionInputsPermutationAck", 506},
+    {"MoneroTransactionInputViniRequest", 507},
+    {"MoneroTransactionInputViniAck", 508},
+    {"MoneroTransactionAllInputsSetRequest", 509},
+    {"MoneroTransactionAllInputsSetAck", 510},
+    {"MoneroTransactionSetOutputRequest", 511},
+    {"MoneroTransactionSetOutputAck", 512},
+    {"MoneroTransactionAllOutSetRequest", 513},
+    {"MoneroTransactionAllOutSetAck", 514},
+    {"MoneroTransactionSignInputRequest", 515},
+    {"MoneroTransactionSignInputAck", 516},
+    {"MoneroTransactionFinalRequest", 517},
+    {"MoneroTransactionFinalAck", 518},
+    {"MoneroKeyImageExportInitRequest", 530},
+    {"MoneroKeyImageExportInitAck", 531},
+    {"MoneroKeyImageSyncStepRequest", 532},
+    {"MoneroKeyImageSyncStepAck", 533},
+    {"MoneroKeyImageSyncFinalRequest", 534},
+    {"MoneroKeyImageSyncFinalAck", 535},
+    {"MoneroGetAddress", 540},
+    {"MoneroAddress", 541},
+    {"MoneroGetWatchKey", 542},
+    {"MoneroWatchKey", 543},
+    {"DebugMoneroDiagRequest", 546},
+    {"DebugMoneroDiagAck", 547},
+    {"MoneroGetTxKeyRequest", 550},
+    {"MoneroGetTxKeyAck", 551},
+    {"MoneroLiveRefreshStartRequest", 552},
+    {"MoneroLiveRefreshStartAck", 553},
+    {"MoneroLiveRefreshStepRequest", 554},
+    {"MoneroLiveRefreshStepAck", 555},
+    {"MoneroLiveRefreshFinalRequest", 556},
+    {"MoneroLiveRefreshFinalAck", 557},
+    {"EosGetPublicKey", 600},
+    {"EosPublicKey", 601},
+    {"EosSignTx", 602},
+    {"EosTxActionRequest", 603},
+    {"EosTxActionAck", 604},
+    {"EosSignedTx", 605},
+    {"BinanceGetAddress", 700},
+    {"BinanceAddress", 701},
+    {"BinanceGetPublicKey", 702},
+    {"BinancePublicKey", 703},
+    {"BinanceSignTx", 704},
+    {"BinanceTxRequest", 705},
+    {"BinanceTransferMsg", 706},
+    {"BinanceOrderMsg", 707},
+    {"BinanceCancelMsg", 708},
+    {"BinanceSignedTx", 709},
+    {"WebAuthnListResidentCredentials", 800},
+    {"WebAuthnCredentials", 801},
+    {"WebAuthnAddResidentCredential", 802},
+    {"WebAuthnRemoveResidentCredential", 803},
+    {"HdsSignMessage", 902},
+    {"HdsSignature", 903},
+    {"HdsVerifyMessage", 904},
+    {"HdsGetPublicKey", 905},
+    {"HdsGetOwnerKey", 907},
+    {"HdsOwnerKey", 908},
+    {"HdsGenerateKey", 909},
+    {"HdsGenerateNonce", 910},
+    {"HdsECCPoint", 911},
+    {"HdsGenerateRangeproof", 912},
+    {"HdsRangeproofData", 913},
+    {"HdsSignTransaction", 914},
+    {"HdsSignedTransaction", 915},
+    {"HdsGetNoncePublic", 916},
+    {"HdsSignTransactionSend", 917},
+    {"HdsSignTransactionSendResult", 918},
+    {"HdsSignTransactionReceive", 919},
+    {"HdsSignTransactionReceiveResult", 920},
+    {"HdsSignTransactionSplit", 921},
+    {"HdsSignTransactionSplitResult", 922},
+    {"HdsGetNumSlots", 923},
+    {"HdsNumSlots", 924},
+    {"HdsGetPKdf", 925},
+    {"HdsPKdf", 926},
+};
@@ -2,7 +2,6 @@
 
 #include <cstdint>
 #include <vector>
-#include <algorithm>
 #include "utils.hpp"
 
 typedef struct
@@ -16,8 +15,15 @@ typedef struct
   T to_message() const
   {
     T message;
-    message.ParseFromArray(msg.data(), static_cast<int>(length));
-    return std::move(message);
+    parse_into(message);
+    return message;
+  }
+
+  // for messages the caller allocates, on a MessageArena for instance
+  template <typename T>
+  bool parse_into(T &message) const
+  {
+    return message.ParseFromArray(msg.data(), static_cast<int>(length));
   }
 
   std::string to_response()
@@ -29,6 +35,18 @@ typedef struct
   {
     copy_reversed(bytes, &type);
     copy_reversed(bytes + sizeof(type), &length);
-    std::copy_n(bytes + sizeof(type) + sizeof(length), length, std::back_inserter(msg));
+    auto body = bytes + sizeof(type) + sizeof(length);
+    msg.assign(body, body + length);
   }
-} Call;
\ No newline at end of file
+} Call;
+
+template <typename T>
+Call make_call(const T &message)
+{
+  Call call;
+  call.type = message_traits<T>::id;
+  call.length = static_cast<uint32_t>(message.ByteSizeLong());
+  call.msg.resize(call.length);
+  message.SerializeToArray(call.msg.data(), static_cast<int>(call.length));
+  return call;
+}
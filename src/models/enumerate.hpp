@@ -2,11 +2,12 @@
 
 #include <string>
 #include "json.hpp"
+#include "session_handle.hpp"
 
 typedef struct
 {
   std::string path;
-  std::string session;
+  SessionHandle session;
   int vendor;
   int product;
 } Enumerate;
@@ -15,7 +16,7 @@ inline void from_json(const nlohmann::json &j, Enumerate &value)
 {
   value.path = j.at("path").get<std::string>();
   auto session = j.at("session");
-  value.session = session.is_null() ? "null" : session.get<std::string>();
+  value.session = session.is_null() ? SessionHandle() : SessionHandle::from_string(session.get<std::string>());
   value.vendor = j.at("vendor").get<int>();
   value.product = j.at("product").get<int>();
 }
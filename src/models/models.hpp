@@ -1,5 +1,6 @@
 #pragma once
 
+#include "session_handle.hpp"
 #include "enumerate.hpp"
 #include "session.hpp"
 #include "call.hpp"
@@ -2,17 +2,18 @@
 
 #include <string>
 #include "json.hpp"
+#include "session_handle.hpp"
 
 typedef struct
 {
-  std::string session;
+  SessionHandle session;
   std::string error;
 } Session;
 
 inline void from_json(const nlohmann::json &j, Session &value)
 {
   if (j.contains("session"))
-    value.session = j.at("session").get<std::string>();
+    value.session = SessionHandle::from_string(j.at("session").get<std::string>());
 
   if (j.contains("error"))
     value.error = j.at("error").get<std::string>();
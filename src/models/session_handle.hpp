@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A bridge session id as one integer. The bridge hands out decimal ids,
+// which are stored as their value; any other id is interned once and
+// stored as its index. An empty handle is no session, what the bridge
+// spells "null". Strings are only made where a URL needs one.
+class SessionHandle
+{
+public:
+  SessionHandle() = default;
+
+  static SessionHandle number(uint64_t id)
+  {
+    return SessionHandle(id <= MAX_NUMBER ? (id << 1) | 1 : intern(std::to_string(id)));
+  }
+
+  static SessionHandle from_string(const std::string &id)
+  {
+    if (id.empty() || id == "null")
+      return SessionHandle();
+
+    uint64_t value = 0;
+    if (parse_number(id, value))
+      return SessionHandle((value << 1) | 1);
+    return SessionHandle(intern(id));
+  }
+
+  bool has_value() const
+  {
+    return m_raw != 0;
+  }
+
+  explicit operator bool() const
+  {
+    return has_value();
+  }
+
+  std::string to_string() const
+  {
+    if (!has_value())
+      return "null";
+    if (m_raw & 1)
+      return std::to_string(m_raw >> 1);
+    return interned(m_raw);
+  }
+
+  uint64_t raw() const
+  {
+    return m_raw;
+  }
+
+  friend bool operator==(const SessionHandle &a, const SessionHandle &b)
+  {
+    return a.m_raw == b.m_raw;
+  }
+
+  friend bool operator!=(const SessionHandle &a, const SessionHandle &b)
+  {
+    return a.m_raw != b.m_raw;
+  }
+
+  friend std::ostream &operator<<(std::ostream &out, const SessionHandle &session)
+  {
+    return out << session.to_string();
+  }
+
+private:
+  // numbers keep the low bit set, interned ids are even and never 0
+  static constexpr uint64_t MAX_NUMBER = std::numeric_limits<uint64_t>::max() >> 1;
+
+  explicit SessionHandle(uint64_t raw) : m_raw(raw)
+  {
+  }
+
+  // only canonical decimals, so to_string gives back the same id
+  static bool parse_number(const std::string &id, uint64_t &value)
+  {
+    if (id.size() > 1 && id[0] == '0')
+      return false;
+
+    value = 0;
+    for (auto c : id)
+    {
+      if (c < '0' || c > '9')
+        return false;
+      auto digit = static_cast<uint64_t>(c - '0');
+      if (value > (MAX_NUMBER - digit) / 10)
+        return false;
+      value = value * 10 + digit;
+    }
+    return true;
+  }
+
+  struct InternTable
+  {
+    std::mutex mutex;
+    std::vector<std::string> ids;
+    std::unordered_map<std::string, uint64_t> raws;
+  };
+
+  // Non-numeric ids are rare and few, they are kept for the whole run
+  static InternTable &table()
+  {
+    static InternTable table;
+    return table;
+  }
+
+  static uint64_t intern(const std::string &id)
+  {
+    auto &t = table();
+    std::unique_lock<std::mutex> lock(t.mutex);
+    auto found = t.raws.find(id);
+    if (found != t.raws.end())
+      return found->second;
+
+    t.ids.push_back(id);
+    uint64_t raw = static_cast<uint64_t>(t.ids.size()) << 1;
+    t.raws.emplace(id, raw);
+    return raw;
+  }
+
+  static std::string interned(uint64_t raw)
+  {
+    auto &t = table();
+    std::unique_lock<std::mutex> lock(t.mutex);
+    return t.ids[(raw >> 1) - 1];
+  }
+
+  uint64_t m_raw = 0;
+};
+
+namespace std
+{
+template <>
+struct hash<SessionHandle>
+{
+  size_t operator()(const SessionHandle &session) const
+  {
+    return std::hash<uint64_t>()(session.raw());
+  }
+};
+} // namespace std
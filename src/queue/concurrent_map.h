@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+// Read-mostly map. Readers take a snapshot without waiting for writers;
+// writers copy the map, change the copy and publish it, so a snapshot is
+// never rehashed under a reader.
+template <typename Key, typename Value>
+class CopyOnWriteMap
+{
+  public:
+    using Map = std::unordered_map<Key, Value>;
+
+    CopyOnWriteMap() : m_map(std::make_shared<const Map>())
+    {
+    }
+
+    CopyOnWriteMap(const CopyOnWriteMap &) = delete;            // disable copying
+    CopyOnWriteMap &operator=(const CopyOnWriteMap &) = delete; // disable assignment
+
+    // stays valid and unchanged for as long as it is held
+    std::shared_ptr<const Map> snapshot() const
+    {
+        return std::atomic_load(&m_map);
+    }
+
+    void set(const Key &key, Value value)
+    {
+        std::unique_lock<std::mutex> lock(m_write_mutex);
+        auto map = std::make_shared<Map>(*m_map);
+        (*map)[key] = std::move(value);
+        std::atomic_store(&m_map, std::shared_ptr<const Map>(std::move(map)));
+    }
+
+    void erase(const Key &key)
+    {
+        std::unique_lock<std::mutex> lock(m_write_mutex);
+        if (m_map->find(key) == m_map->end())
+            return;
+
+        auto map = std::make_shared<Map>(*m_map);
+        map->erase(key);
+        std::atomic_store(&m_map, std::shared_ptr<const Map>(std::move(map)));
+    }
+
+  private:
+    std::mutex m_write_mutex;
+    std::shared_ptr<const Map> m_map;
+};
+
+// Map split into independently locked shards, so threads working on
+// different keys rarely contend.
+template <typename Key, typename Value, size_t Shards = 16>
+class ShardedMap
+{
+  public:
+    ShardedMap() = default;
+
+    ShardedMap(const ShardedMap &) = delete;            // disable copying
+    ShardedMap &operator=(const ShardedMap &) = delete; // disable assignment
+
+    void emplace(const Key &key, Value value)
+    {
+        auto &shard = shard_of(key);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        shard.map[key] = std::move(value);
+    }
+
+    // moves the value out and erases the key
+    bool take(const Key &key, Value &value)
+    {
+        auto &shard = shard_of(key);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto found = shard.map.find(key);
+        if (found == shard.map.end())
+            return false;
+
+        value = std::move(found->second);
+        shard.map.erase(found);
+        return true;
+    }
+
+    // values are destroyed outside the shard locks
+    void clear()
+    {
+        for (auto &shard : m_shards)
+        {
+            std::unordered_map<Key, Value> dropped;
+            {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                dropped.swap(shard.map);
+            }
+        }
+    }
+
+  private:
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<Key, Value> map;
+    };
+
+    Shard &shard_of(const Key &key)
+    {
+        return m_shards[std::hash<Key>()(key) % Shards];
+    }
+
+    std::array<Shard, Shards> m_shards;
+};
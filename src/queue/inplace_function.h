@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature, size_t Capacity = 64>
+class InplaceFunction;
+
+// Move-only std::function replacement. Callables up to Capacity bytes are
+// stored inside the object, so wrapping a lambda with a small capture does
+// not allocate; bigger ones fall back to the heap.
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+  public:
+    InplaceFunction() = default;
+
+    InplaceFunction(std::nullptr_t)
+    {
+    }
+
+    template <typename F, typename Callable = typename std::decay<F>::type,
+              typename = typename std::enable_if<!std::is_same<Callable, InplaceFunction>::value>::type>
+    InplaceFunction(F &&function)
+    {
+        assign<Callable>(std::forward<F>(function), std::integral_constant<bool, fits<Callable>()>());
+    }
+
+    InplaceFunction(InplaceFunction &&other) noexcept
+    {
+        move_from(other);
+    }
+
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction &operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    InplaceFunction(const InplaceFunction &) = delete;
+    InplaceFunction &operator=(const InplaceFunction &) = delete;
+
+    ~InplaceFunction()
+    {
+        reset();
+    }
+
+    R operator()(Args... args) const
+    {
+        return m_ops->invoke(&m_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const
+    {
+        return m_ops != nullptr;
+    }
+
+    friend bool operator==(const InplaceFunction &function, std::nullptr_t)
+    {
+        return !function;
+    }
+
+    friend bool operator!=(const InplaceFunction &function, std::nullptr_t)
+    {
+        return static_cast<bool>(function);
+    }
+
+  private:
+    using Storage = typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type;
+
+    struct Ops
+    {
+        R (*invoke)(void *, Args &&...);
+        void (*move)(void *from, void *to);
+        void (*destroy)(void *);
+    };
+
+    template <typename Callable>
+    static constexpr bool fits()
+    {
+        return sizeof(Callable) <= Capacity && alignof(Callable) <= alignof(Storage) &&
+               std::is_nothrow_move_constructible<Callable>::value;
+    }
+
+    template <typename Callable, typename F>
+    void assign(F &&function, std::true_type)
+    {
+        static const Ops ops = {
+            [](void *storage, Args &&... args) -> R {
+                return (*static_cast<Callable *>(storage))(std::forward<Args>(args)...);
+            },
+            [](void *from, void *to) {
+                new (to) Callable(std::move(*static_cast<Callable *>(from)));
+                static_cast<Callable *>(from)->~Callable();
+            },
+            [](void *storage) {
+                static_cast<Callable *>(storage)->~Callable();
+            }};
+        new (&m_storage) Callable(std::forward<F>(function));
+        m_ops = &ops;
+    }
+
+    // the storage only holds a pointer to the callable
+    template <typename Callable, typename F>
+    void assign(F &&function, std::false_type)
+    {
+        static const Ops ops = {
+            [](void *storage, Args &&... args) -> R {
+                return (**static_cast<Callable **>(storage))(std::forward<Args>(args)...);
+            },
+            [](void *from, void *to) {
+                *static_cast<Callable **>(to) = *static_cast<Callable **>(from);
+            },
+            [](void *storage) {
+                delete *static_cast<Callable **>(storage);
+            }};
+        *reinterpret_cast<Callable **>(&m_storage) = new Callable(std::forward<F>(function));
+        m_ops = &ops;
+    }
+
+    void move_from(InplaceFunction &other)
+    {
+        if (other.m_ops)
+        {
+            other.m_ops->move(&other.m_storage, &m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+    void reset()
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(&m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    mutable Storage m_storage;
+    const Ops *m_ops = nullptr;
+};
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include "queue.h"
+
+// Lock-free multi-producer/single-consumer queue with the interface of
+// Queue<T>. Producers only exchange the head pointer; the consumer thread
+// sleeps on a condition variable when it runs dry, and producers take the
+// mutex only to wake it.
+//
+// There is no random access, so WorkingQueue cannot replace or remove keyed
+// items in it, it has a single lane, priorities are ignored, and it is
+// unbounded. clear() may be called from any thread: it marks everything
+// pushed so far, and the consumer drops marked items instead of popping them.
+template <typename T>
+class MpscQueue
+{
+public:
+
+    MpscQueue() : m_head(new Node()), m_tail(m_head.load())
+    {
+    }
+
+    MpscQueue (const MpscQueue&) = delete;            // disable copying
+    MpscQueue& operator= (const MpscQueue&) = delete; // disable assignment
+
+    ~MpscQueue()
+    {
+        while (m_tail)
+        {
+            auto next = m_tail->next.load();
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    // pop and try_pop must only be called from one thread at a time
+    bool pop (T& item)
+    {
+        for (;;)
+        {
+            if (m_closed)
+                return false;
+            if (!m_pop_lock && take(item))
+                return true;
+
+            std::unique_lock<std::mutex> mlock(m_mutex);
+            m_sleeping = true;
+            m_cond.wait(mlock, [this] { return m_closed || (!m_pop_lock && m_tail->next.load() != nullptr); });
+            m_sleeping = false;
+        }
+    }
+
+    bool try_pop (T& item)
+    {
+        return !m_closed && !m_pop_lock && take(item);
+    }
+
+    // unbounded, so every push is queued
+    PushResult push (T&& item, Priority = Priority::Normal, bool = true)
+    {
+        link(new Node(std::move(item)));
+        return PushResult::Queued;
+    }
+
+    PushResult push (const T& item, Priority = Priority::Normal, bool = true)
+    {
+        link(new Node(item));
+        return PushResult::Queued;
+    }
+
+    void clear ()
+    {
+        auto pushed = m_pushed.load();
+        auto cleared = m_cleared.load();
+        while (cleared < pushed && !m_cleared.compare_exchange_weak(cleared, pushed))
+            ;
+    }
+
+    // items not taken by the consumer yet, cleared ones included until it
+    // gets to them
+    size_t size()
+    {
+        return m_size.load();
+    }
+
+    void unlockPop()
+    {
+        m_pop_lock = false;
+        wake();
+    }
+
+    void lockPop()
+    {
+        m_pop_lock = true;
+    }
+
+    void close()
+    {
+        m_closed = true;
+        wake();
+    }
+
+private:
+    struct Node
+    {
+        Node() = default;
+        explicit Node(T &&item) : value(std::move(item)) {}
+        explicit Node(const T &item) : value(item) {}
+
+        std::atomic<Node *> next{nullptr};
+        size_t sequence = 0;
+        T value;
+    };
+
+    void link(Node *node)
+    {
+        node->sequence = ++m_pushed;
+        ++m_size;
+        auto prev = m_head.exchange(node);
+        prev->next.store(node);
+        if (m_sleeping)
+            wake();
+    }
+
+    // m_tail is a consumed node, the first item lives in its successor
+    bool take(T& item)
+    {
+        for (;;)
+        {
+            auto next = m_tail->next.load();
+            if (!next)
+                return false;
+
+            delete m_tail;
+            m_tail = next;
+            --m_size;
+            if (next->sequence > m_cleared.load())
+            {
+                item = std::move(next->value);
+                return true;
+            }
+        }
+    }
+
+    void wake()
+    {
+        {
+            // pairs with the predicate check of a consumer about to sleep
+            std::unique_lock<std::mutex> mlock(m_mutex);
+        }
+        m_cond.notify_one();
+    }
+
+    std::atomic<Node *> m_head;
+    Node *m_tail;
+    std::atomic<size_t> m_pushed{0};
+    std::atomic<size_t> m_cleared{0};
+    std::atomic<size_t> m_size{0};
+
+    std::atomic_bool m_pop_lock{false};
+    std::atomic_bool m_closed{false};
+    std::atomic_bool m_sleeping{false};
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
@@ -1,69 +1,407 @@
 #pragma once
 
-#include <deque>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
 #include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
 #include <condition_variable>
+#include <functional>
+#include "queue_index.h"
 
+// Lanes of a Queue, served in this order
+enum class Priority : uint8_t
+{
+    Interactive,
+    Normal,
+    Bulk
+};
+
+// What a full bounded Queue does with another push
+enum class OverflowPolicy : uint8_t
+{
+    Block,         // wait until there is room
+    FailFast,      // refuse the push
+    ShedOldestBulk // drop the oldest Bulk item to make room, else refuse
+};
+
+enum class PushResult : uint8_t
+{
+    Queued,
+    Replaced, // took the place of a queued item with the same key
+    Full,
+    Closed,
+    Locked // WorkingQueue::lockPush
+};
+
+// Tuple items are keyed by their first element, so Queue can find them
+// through a hash index. Other items have no key.
+template <typename T>
+struct queue_item_key
+{
+    static constexpr bool keyed = false;
+    using type = int;
+
+    static type get(const T &)
+    {
+        return 0;
+    }
+};
+
+template <typename K, typename... Rest>
+struct queue_item_key<std::tuple<K, Rest...>>
+{
+    static constexpr bool keyed = true;
+    using type = K;
+
+    static const K &get(const std::tuple<K, Rest...> &item)
+    {
+        return std::get<0>(item);
+    }
+};
+
+// Pops from the highest non-empty lane, FIFO within a lane. A waiting lower
+// lane is served at the latest after STARVATION_LIMIT items from above it.
 template <typename T>
 class Queue
 {
+    struct Entry
+    {
+        T item;
+        Priority priority = Priority::Normal;
+        bool bounded = true;
+    };
+
+    using List = std::list<Entry>;
+    using Key = queue_item_key<T>;
+
+    struct EntryKey
+    {
+        using type = typename Key::type;
+
+        static decltype(Key::get(std::declval<const T &>())) get(const Entry &entry)
+        {
+            return Key::get(entry.item);
+        }
+    };
+
+    static constexpr size_t LANES = 3;
+    static constexpr unsigned STARVATION_LIMIT = 4;
+
 public:
 
-    Queue() : m_pop_lock(false)
+    Queue()
     {
     }
 
     Queue (const Queue&) = delete;            // disable copying
     Queue& operator= (const Queue&) = delete; // disable assignment
 
-    bool pop (T& item, size_t timeout = 200)
+    // Sleeps until an item can be taken: the queue is not empty and pop is
+    // not locked. Returns false once the queue is closed.
+    bool pop (T& item)
     {
-        if (!m_pop_lock.load())
-        {
-            std::unique_lock<std::mutex> mlock(m_mutex);
-            if (m_cond.wait_for(mlock, std::chrono::milliseconds(timeout), [this] { return !m_deque.empty(); }))
-            {
-                item = std::move(m_deque.front());
-                m_deque.pop_front();
-                return true;
-            }
-        }
-        return false; 
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        m_cond.wait(mlock, [this] { return m_closed || (!m_pop_lock && m_size != 0); });
+        if (m_closed)
+            return false;
+
+        take(item);
+        return true;
+    }
+
+    // takes an item only if pop would not have to wait for one
+    bool try_pop (T& item)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        if (m_closed || m_pop_lock || m_size == 0)
+            return false;
+
+        take(item);
+        return true;
+    }
+
+    // Unbounded pushes ignore the capacity, for the few control items that
+    // must not be refused
+    PushResult push (T&& item, Priority priority = Priority::Normal, bool bounded = true)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        return insert(mlock, nullptr, std::move(item), priority, bounded);
+    }
+
+    PushResult push (const T& item, Priority priority = Priority::Normal, bool bounded = true)
+    {
+        return push(T(item), priority, bounded);
+    }
+
+    // Overwrites the queued item with the same key in place, so it keeps its
+    // position and lane. Leaves item untouched and returns false if there is
+    // none.
+    bool replace (T&& item)
+    {
+        static_assert(Key::keyed, "items have no key");
+        std::unique_lock<std::mutex> mlock(m_mutex);
+
+        auto found = m_index.find(Key::get(item));
+        if (!found)
+            return false;
+
+        (*found)->item = std::move(item);
+        return true;
+    }
+
+    // replace, or push if nothing with the same key is queued
+    PushResult push_or_replace (T&& item, Priority priority = Priority::Normal, bool bounded = true)
+    {
+        static_assert(Key::keyed, "items have no key");
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        return insert(mlock, &Key::get(item), std::move(item), priority, bounded);
     }
 
-    void push (const T& item)
+    // 0 is unbounded, the default
+    void setCapacity (size_t capacity, OverflowPolicy policy)
     {
         std::unique_lock<std::mutex> mlock(m_mutex);
-        m_deque.push_back(item);
+        m_capacity = capacity;
+        m_policy = policy;
         mlock.unlock();
-        m_cond.notify_one();
+        m_not_full.notify_all();
+    }
+
+    // gets the items ShedOldestBulk drops, outside the queue lock. Items
+    // pushed unbounded are never dropped.
+    void setDropCallback (std::function<void(T&&)> callback)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        m_drop_callback = std::move(callback);
     }
 
-    void clear ()
+    void remove (const typename Key::type &key)
     {
-        m_deque.clear();
+        static_assert(Key::keyed, "items have no key");
+        std::unique_lock<std::mutex> mlock(m_mutex);
+
+        auto found = m_index.find(key);
+        if (found)
+        {
+            auto node = *found;
+            m_index.erase(node);
+            recycle(node);
+            mlock.unlock();
+            m_not_full.notify_all();
+        }
+    }
+
+    // removed gets every item taken out, outside the queue lock
+    void clear (std::function<void(T&&)> removed = nullptr)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        std::vector<T> items;
+        for (auto &lane : m_lanes)
+        {
+            while (!lane.empty())
+            {
+                if (removed)
+                    items.push_back(std::move(lane.front().item));
+                recycle(lane.begin());
+            }
+        }
+        m_index.clear();
+        m_skipped.fill(0);
+        mlock.unlock();
+        m_not_full.notify_all();
+
+        for (auto &item : items)
+            removed(std::move(item));
     }
 
     size_t size()
     {
-        return m_deque.size();
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        return m_size;
     }
 
     void unlockPop()
     {
+        std::unique_lock<std::mutex> mlock(m_mutex);
         m_pop_lock = false;
+        mlock.unlock();
+        m_cond.notify_one();
     }
 
     void lockPop()
     {
+        std::unique_lock<std::mutex> mlock(m_mutex);
         m_pop_lock = true;
     }
 
-protected:
-    std::deque<T> m_deque;
-    std::mutex m_mutex;
+    // wakes every waiting pop for good, used on shutdown
+    void close()
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        m_closed = true;
+        mlock.unlock();
+        m_cond.notify_all();
+        m_not_full.notify_all();
+    }
 
 private:
-    std::atomic_bool m_pop_lock;
+    // key is set when an item with the same key is to be replaced
+    PushResult insert(std::unique_lock<std::mutex> &mlock, const typename Key::type *key, T&& item, Priority priority, bool bounded)
+    {
+        if (m_closed)
+            return PushResult::Closed;
+
+        if (key)
+        {
+            if (auto found = m_index.find(*key))
+            {
+                (*found)->item = std::move(item);
+                return PushResult::Replaced;
+            }
+        }
+
+        T dropped;
+        bool has_dropped = false;
+        if (bounded && m_capacity != 0 && m_size >= m_capacity)
+        {
+            if (m_policy == OverflowPolicy::Block)
+            {
+                m_not_full.wait(mlock, [this] { return m_closed || m_capacity == 0 || m_size < m_capacity; });
+                // the item may have been queued meanwhile
+                if (key && !m_closed)
+                {
+                    if (auto found = m_index.find(*key))
+                    {
+                        (*found)->item = std::move(item);
+                        return PushResult::Replaced;
+                    }
+                }
+            }
+            else
+            {
+                auto oldest = m_policy == OverflowPolicy::ShedOldestBulk ? shed_candidate() : bulk().end();
+                if (oldest == bulk().end())
+                    return PushResult::Full;
+
+                if (Key::keyed)
+                    m_index.erase(oldest);
+                dropped = std::move(oldest->item);
+                has_dropped = true;
+                recycle(oldest);
+            }
+        }
+
+        if (m_closed)
+            return PushResult::Closed;
+
+        append(std::move(item), priority, bounded);
+        auto drop_callback = has_dropped ? m_drop_callback : nullptr;
+        mlock.unlock();
+        m_cond.notify_one();
+
+        if (drop_callback)
+            drop_callback(std::move(dropped));
+        return PushResult::Queued;
+    }
+
+    List &bulk()
+    {
+        return m_lanes[static_cast<size_t>(Priority::Bulk)];
+    }
+
+    typename List::iterator shed_candidate()
+    {
+        return std::find_if(bulk().begin(), bulk().end(), [](const Entry &entry) { return entry.bounded; });
+    }
+
+    // Popped nodes are kept in m_free and reused, so a queue that has reached
+    // its working size does not allocate on push. The index points at the
+    // newest item of a key when plain push queued several.
+    void append(T&& item, Priority priority, bool bounded)
+    {
+        auto &lane = m_lanes[static_cast<size_t>(priority)];
+        if (m_free.empty())
+        {
+            lane.emplace_back();
+        }
+        else
+        {
+            lane.splice(lane.end(), m_free, m_free.begin());
+        }
+
+        auto node = std::prev(lane.end());
+        node->item = std::move(item);
+        node->priority = priority;
+        node->bounded = bounded;
+        m_size++;
+
+        if (Key::keyed)
+            m_index.assign(node);
+    }
+
+    void take(T& item)
+    {
+        auto &lane = m_lanes[next_lane()];
+        auto front = lane.begin();
+        if (Key::keyed)
+            m_index.erase(front);
+
+        item = std::move(front->item);
+        recycle(front);
+        m_not_full.notify_one();
+    }
+
+    // the highest non-empty lane, unless a lower one has waited too long
+    size_t next_lane()
+    {
+        size_t next = LANES;
+        for (size_t i = 0; i < LANES; i++)
+        {
+            if (m_lanes[i].empty())
+                continue;
+            if (next == LANES)
+            {
+                next = i;
+            }
+            else if (m_skipped[i] >= STARVATION_LIMIT)
+            {
+                next = i;
+                break;
+            }
+        }
+
+        for (size_t i = next + 1; i < LANES; i++)
+        {
+            if (!m_lanes[i].empty())
+                m_skipped[i]++;
+        }
+        m_skipped[next] = 0;
+        return next;
+    }
+
+    // drops the item right away, it may hold on to resources
+    void recycle(typename List::iterator node)
+    {
+        node->item = T();
+        m_free.splice(m_free.end(), m_lanes[static_cast<size_t>(node->priority)], node);
+        m_size--;
+    }
+
+    std::mutex m_mutex;
+    std::array<List, LANES> m_lanes;
+    std::array<unsigned, LANES> m_skipped{};
+    size_t m_size = 0;
+    List m_free;
+    QueueIndex<EntryKey, typename List::iterator> m_index;
+    size_t m_capacity = 0;
+    OverflowPolicy m_policy = OverflowPolicy::Block;
+    std::function<void(T&&)> m_drop_callback;
+    bool m_pop_lock = false;
+    bool m_closed = false;
     std::condition_variable m_cond;
+    std::condition_variable m_not_full;
 };
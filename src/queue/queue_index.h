@@ -0,0 +1,127 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// Open addressing hash index from item keys to list nodes, used by Queue.
+// Slots hold only the node and the key's hash, the key itself is read
+// through the node, so inserts and erases do not allocate once the table
+// has grown to the queue's working size.
+template <typename KeyOf, typename Iterator>
+class QueueIndex
+{
+    using Key = typename KeyOf::type;
+
+  public:
+    QueueIndex() : m_slots(MIN_SLOTS)
+    {
+    }
+
+    Iterator *find(const Key &key)
+    {
+        auto hash = std::hash<Key>()(key);
+        for (auto i = hash & mask();; i = (i + 1) & mask())
+        {
+            auto &slot = m_slots[i];
+            if (!slot.used)
+                return nullptr;
+            if (slot.hash == hash && KeyOf::get(*slot.node) == key)
+                return &slot.node;
+        }
+    }
+
+    // points the key of *node at node, replacing what it pointed at
+    void assign(Iterator node)
+    {
+        if (auto found = find(KeyOf::get(*node)))
+        {
+            *found = node;
+            return;
+        }
+
+        if (2 * (m_size + 1) > m_slots.size())
+            grow();
+        insert(node, std::hash<Key>()(KeyOf::get(*node)));
+        m_size++;
+    }
+
+    // erases the key only while it still points at node
+    void erase(Iterator node)
+    {
+        auto hash = std::hash<Key>()(KeyOf::get(*node));
+        for (auto i = hash & mask();; i = (i + 1) & mask())
+        {
+            auto &slot = m_slots[i];
+            if (!slot.used)
+                return;
+            if (slot.node == node)
+            {
+                erase_slot(i);
+                m_size--;
+                return;
+            }
+        }
+    }
+
+    void clear()
+    {
+        for (auto &slot : m_slots)
+            slot.used = false;
+        m_size = 0;
+    }
+
+  private:
+    struct Slot
+    {
+        Iterator node;
+        size_t hash = 0;
+        bool used = false;
+    };
+
+    static constexpr size_t MIN_SLOTS = 16;
+
+    size_t mask() const
+    {
+        return m_slots.size() - 1;
+    }
+
+    void insert(Iterator node, size_t hash)
+    {
+        auto i = hash & mask();
+        while (m_slots[i].used)
+            i = (i + 1) & mask();
+        m_slots[i].node = node;
+        m_slots[i].hash = hash;
+        m_slots[i].used = true;
+    }
+
+    // backward shift deletion, keeps probe sequences intact without tombstones
+    void erase_slot(size_t hole)
+    {
+        for (auto i = (hole + 1) & mask(); m_slots[i].used; i = (i + 1) & mask())
+        {
+            auto home = m_slots[i].hash & mask();
+            bool stays = hole < i ? (home > hole && home <= i) : (home > hole || home <= i);
+            if (!stays)
+            {
+                m_slots[hole] = m_slots[i];
+                hole = i;
+            }
+        }
+        m_slots[hole].used = false;
+    }
+
+    void grow()
+    {
+        std::vector<Slot> slots(2 * m_slots.size());
+        slots.swap(m_slots);
+        for (auto &slot : slots)
+        {
+            if (slot.used)
+                insert(slot.node, slot.hash);
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "queue.h"
+
+// Fixed set of threads running posted tasks in no particular order.
+// WorkingQueues built on a pool run as strands on it, so per-queue order is
+// kept while any number of queues share the threads.
+class ThreadPool
+{
+  public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+    {
+        threads = std::max<size_t>(threads, 1);
+        m_threads.reserve(threads);
+        for (size_t i = 0; i < threads; i++)
+            m_threads.emplace_back(&ThreadPool::_threadMain, this);
+    }
+
+    ThreadPool(const ThreadPool &) = delete;            // disable copying
+    ThreadPool &operator=(const ThreadPool &) = delete; // disable assignment
+
+    // tasks not started yet are dropped
+    ~ThreadPool()
+    {
+        m_tasks.close();
+        for (auto &thread : m_threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    void post(Task task)
+    {
+        m_tasks.push(std::move(task));
+    }
+
+    size_t size() const
+    {
+        return m_threads.size();
+    }
+
+  private:
+    void _threadMain()
+    {
+        Task task;
+        while (m_tasks.pop(task))
+        {
+            task();
+            task = nullptr;
+        }
+    }
+
+    Queue<Task> m_tasks;
+    std::vector<std::thread> m_threads;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// One background thread that runs delayed tasks for every device, so idle
+// deadlines do not cost a sleeping thread per device.
+class Timer
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Task = std::function<void()>;
+    using Id = uint64_t;
+
+    static Timer &shared()
+    {
+        static Timer timer;
+        return timer;
+    }
+
+    Timer() : m_thread(&Timer::_threadMain, this)
+    {
+    }
+
+    Timer(const Timer &) = delete;            // disable copying
+    Timer &operator=(const Timer &) = delete; // disable assignment
+
+    ~Timer()
+    {
+        {
+            std::unique_lock<std::mutex> mlock(m_mutex);
+            m_alive = false;
+        }
+        m_cond.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    Id schedule(Clock::duration delay, Task task)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        auto id = ++m_lastId;
+        m_tasks.emplace(std::make_pair(Clock::now() + delay, id), std::move(task));
+        mlock.unlock();
+        m_cond.notify_all();
+        return id;
+    }
+
+    // Drops a pending task. If the task is running right now, waits for it to
+    // finish, so the caller may destroy whatever the task captured.
+    void cancel(Id id)
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        for (auto it = m_tasks.begin(); it != m_tasks.end(); ++it)
+        {
+            if (it->first.second == id)
+            {
+                m_tasks.erase(it);
+                return;
+            }
+        }
+        m_cond.wait(mlock, [&] { return m_runningId != id; });
+    }
+
+  private:
+    void _threadMain()
+    {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        while (m_alive)
+        {
+            if (m_tasks.empty())
+            {
+                m_cond.wait(mlock);
+                continue;
+            }
+
+            auto next = m_tasks.begin();
+            // a copy, cancel() may erase the node while the lock is released
+            auto deadline = next->first.first;
+            if (Clock::now() < deadline)
+            {
+                m_cond.wait_until(mlock, deadline);
+                continue;
+            }
+
+            auto task = std::move(next->second);
+            m_runningId = next->first.second;
+            m_tasks.erase(next);
+
+            mlock.unlock();
+            task();
+            mlock.lock();
+
+            m_runningId = 0;
+            m_cond.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::map<std::pair<Clock::time_point, Id>, Task> m_tasks;
+    Id m_lastId = 0;
+    Id m_runningId = 0;
+    bool m_alive = true;
+    std::thread m_thread;
+};
@@ -1,39 +1,81 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
 #include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
+#include "inplace_function.h"
 #include "queue.h"
+#include "mpsc_queue.h"
+#include "thread_pool.h"
 #include "models/call.hpp"
 
+// big enough for the tasks BaseDeviceManager queues, so pushing them does
+// not allocate
+constexpr size_t IN_QUEUE_FUNCTION_CAPACITY = 128;
+
 template <typename O, typename I>
-using InQueueFunction = std::function<O(const I &)>;
+using InQueueFunction = InplaceFunction<O(const I &), IN_QUEUE_FUNCTION_CAPACITY>;
 template <typename O, typename I>
-using PopCallback = std::function<void(const I &, const O &)>;
+using PopCallback = InplaceFunction<void(const I &, const O &), IN_QUEUE_FUNCTION_CAPACITY>;
 template <typename O, typename I>
 using InQueueItem = std::tuple<I, InQueueFunction<O, I>, PopCallback<O, I>>;
 
-template <typename O, typename I>
-class WorkingQueue : public Queue<InQueueItem<O, I>>
+// whether a storage lets WorkingQueue find queued items by their key
+template <template <typename> class Storage>
+struct is_keyed_storage : std::true_type
+{
+};
+
+template <>
+struct is_keyed_storage<MpscQueue> : std::false_type
 {
+};
+
+// Storage is Queue, which replaces a queued item pushed again with the same
+// key, or MpscQueue, which takes every push without locking.
+// Without a pool the queue runs items on its own thread, with one it runs
+// them as a strand on the pool: in order, one at a time.
+template <typename O, typename I, template <typename> class Storage = Queue>
+class WorkingQueue : public Storage<InQueueItem<O, I>>
+{
+    using Base = Storage<InQueueItem<O, I>>;
+    using Keyed = is_keyed_storage<Storage>;
+
   public:
-    WorkingQueue()
-        : m_thread(&WorkingQueue::_threadMain, this),
-          m_globalPopCallback(nullptr),
+    explicit WorkingQueue(std::shared_ptr<ThreadPool> pool = nullptr)
+        : m_globalPopCallback(nullptr),
           m_PauseMillis(0),
-          m_pushLock(false)
+          m_pushLock(false),
+          m_pool(std::move(pool)),
+          m_thread(m_pool ? std::thread() : std::thread(&WorkingQueue::_threadMain, this))
     {
     }
 
     ~WorkingQueue()
     {
-        m_alive.clear();
+        stop();
+    }
+
+    // Closes the queue and waits for the item being processed. Items still
+    // queued are not run. Must not be called from the queue's own items.
+    void stop()
+    {
+        Base::close();
         if (m_thread.joinable())
         {
             m_thread.join();
         }
+
+        if (m_pool)
+        {
+            std::unique_lock<std::mutex> lock(m_strandMutex);
+            m_strandIdle.wait(lock, [this] { return m_scheduled == 0; });
+        }
     }
 
     void lockPush()
@@ -46,50 +88,65 @@ class WorkingQueue : public Queue<InQueueItem<O, I>>
         m_pushLock = false;
     }
 
-    void push(const I &args, InQueueFunction<O, I> function, PopCallback<O, I> callback = nullptr)
+    // bounded is false only for control items that must get through a full queue
+    PushResult push(const I &args, InQueueFunction<O, I> function, PopCallback<O, I> callback = nullptr,
+                    Priority priority = Priority::Normal, bool bounded = true)
     {
-        if (!m_pushLock)
-        {
-            if (!replase(args, function, callback))
-            {
-                Queue<InQueueItem<O, I>>::push(std::make_tuple(args, function, callback));
-            }
-        }
+        if (m_pushLock)
+            return PushResult::Locked;
+
+        auto result = push_item(std::make_tuple(args, std::move(function), std::move(callback)), priority, bounded, Keyed());
+        if (result == PushResult::Queued)
+            schedule();
+        return result;
     }
 
-    void remove(const I &args)
+    // gets the key of every item the overflow policy drops
+    void setDropCallback(std::function<void(const I &)> callback)
     {
-        std::unique_lock<std::mutex> mlock(Queue<InQueueItem<O, I>>::m_mutex);
+        if (!callback)
+        {
+            Base::setDropCallback(nullptr);
+            return;
+        }
 
-        auto &deque = Queue<InQueueItem<O, I>>::m_deque;
-        deque.erase(
-            std::remove_if(deque.begin(), deque.end(), [&](const InQueueItem<O, I> &item) {
-                return std::get<0>(item) == args;
-            }),
-            deque.end());
+        Base::setDropCallback([callback](InQueueItem<O, I> &&item) {
+            callback(std::get<0>(item));
+        });
     }
 
-    bool replase(const I &old_args, const InQueueFunction<O, I>& new_function, const PopCallback<O, I>& new_callback)
+    void unlockPop()
     {
-        std::unique_lock<std::mutex> mlock(Queue<InQueueItem<O, I>>::m_mutex);
-        auto &deque = Queue<InQueueItem<O, I>>::m_deque;
+        Base::unlockPop();
+        schedule();
+    }
 
-        auto it = std::find_if(deque.begin(), deque.end(), [&](const InQueueItem<O, I> &item) {
-            return std::get<0>(item) == old_args;
+    using Base::clear;
+
+    // gets the key of every item it takes out
+    void clear(std::function<void(const I &)> removed)
+    {
+        static_assert(Keyed::value, "storage does not report cleared items");
+        Base::clear([&removed](InQueueItem<O, I> &&item) {
+            removed(std::get<0>(item));
         });
+    }
 
-        if (it != deque.end())
-        {
-            std::get<1>(*it) = new_function;
-            std::get<2>(*it) = new_callback;
-            return true;
-        }
-        return false;
+    void remove(const I &args)
+    {
+        static_assert(Keyed::value, "storage does not support removing keyed items");
+        Base::remove(args);
+    }
+
+    bool replase(const I &old_args, InQueueFunction<O, I> new_function, PopCallback<O, I> new_callback)
+    {
+        static_assert(Keyed::value, "storage does not support replacing keyed items");
+        return Base::replace(InQueueItem<O, I>(old_args, std::move(new_function), std::move(new_callback)));
     }
 
     void setGlobalPopCallback(PopCallback<O, I> callback)
     {
-        m_globalPopCallback = callback;
+        m_globalPopCallback = std::move(callback);
     }
 
     void setPause(unsigned long millis)
@@ -98,37 +155,90 @@ class WorkingQueue : public Queue<InQueueItem<O, I>>
     }
 
   private:
+    PushResult push_item(InQueueItem<O, I> &&item, Priority priority, bool bounded, std::true_type)
+    {
+        return Base::push_or_replace(std::move(item), priority, bounded);
+    }
+
+    PushResult push_item(InQueueItem<O, I> &&item, Priority priority, bool bounded, std::false_type)
+    {
+        return Base::push(std::move(item), priority, bounded);
+    }
+
     void _threadMain()
     {
-        while (m_alive.test_and_set())
+        for (;;)
+        {
+            InQueueItem<O, I> item;
+            if (!Base::pop(item))
+                break;
+
+            process(item);
+        }
+    }
+
+    // m_scheduled counts the wakeups since the strand last went idle; while
+    // it is not zero exactly one drain is posted or running
+    void schedule()
+    {
+        if (m_pool && m_scheduled.fetch_add(1) == 0)
+        {
+            m_pool->post([this] { drain(); });
+        }
+    }
+
+    void drain()
+    {
+        for (;;)
         {
+            auto seen = m_scheduled.load();
             InQueueItem<O, I> item;
-            if (Queue<InQueueItem<O, I>>::pop(item))
+            if (Base::try_pop(item))
             {
-                auto result = std::move(std::get<1>(item)(std::get<0>(item)));
-                auto pop_callback = std::get<2>(item);
-
-                if (pop_callback)
-                {
-                    pop_callback(std::get<0>(item), result);
-                }
-                if (m_globalPopCallback)
-                {
-                    m_globalPopCallback(std::get<0>(item), result);
-                }
+                process(item);
+                // one item per turn, so the other strands on the pool get theirs
+                m_pool->post([this] { drain(); });
+                return;
             }
 
-            if (m_PauseMillis)
+            std::unique_lock<std::mutex> lock(m_strandMutex);
+            if (m_scheduled.compare_exchange_strong(seen, 0))
             {
-                std::this_thread::sleep_for(std::chrono::milliseconds(m_PauseMillis));
+                m_strandIdle.notify_all();
+                return;
             }
         }
     }
 
-    std::atomic_flag m_alive = {1};
-    std::thread m_thread;
+    void process(InQueueItem<O, I> &item)
+    {
+        auto result = std::move(std::get<1>(item)(std::get<0>(item)));
+        auto &pop_callback = std::get<2>(item);
+
+        if (pop_callback)
+        {
+            pop_callback(std::get<0>(item), result);
+        }
+        if (m_globalPopCallback)
+        {
+            m_globalPopCallback(std::get<0>(item), result);
+        }
+
+        if (m_PauseMillis)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_PauseMillis));
+        }
+    }
+
     PopCallback<O, I> m_globalPopCallback;
     std::atomic<unsigned long> m_PauseMillis;
 
     std::atomic_bool m_pushLock;
+
+    std::shared_ptr<ThreadPool> m_pool;
+    std::atomic<size_t> m_scheduled{0};
+    std::mutex m_strandMutex;
+    std::condition_variable m_strandIdle;
+    // started last, so the loop never sees members under construction
+    std::thread m_thread;
 };
\ No newline at end of file
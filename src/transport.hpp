@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "models/models.hpp"
+
+// What BaseDeviceManager needs from a device connection. Messages are the
+// bridge wire format produced by pack_message: hex of type, length and body.
+class Transport
+{
+  public:
+    using CallHandler = std::function<void(Call)>;
+
+    virtual ~Transport()
+    {
+    }
+
+    virtual std::vector<Enumerate> enumerate() const = 0;
+    virtual Session acquire(std::string path, SessionHandle previousSession = SessionHandle()) const = 0;
+    virtual Session release(SessionHandle session) const = 0;
+    virtual Call call(SessionHandle session, const std::string &hex) const = 0;
+
+    // Async transports return from call_async right away and run done on
+    // their own thread once the response arrives.
+    virtual bool is_async() const
+    {
+        return false;
+    }
+
+    virtual void call_async(SessionHandle session, std::string hex, CallHandler done) const
+    {
+        done(call(session, hex));
+    }
+};
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "models/models.hpp"
+#include "transport.hpp"
+#include "utils.hpp"
+
+// Talks to a Trezor emulator over UDP without trezord in between, using the
+// 64-byte packet framing from vendor/trezor-common/protob/protocol.md.
+// The emulator has no sessions, so they are only emulated locally. A call
+// fails when no response starts within response_timeout_millis, which has to
+// leave time for confirming on the device.
+class UdpClient : public Transport
+{
+  public:
+    explicit UdpClient(std::string host = "127.0.0.1", uint16_t port = 21324,
+                       int response_timeout_millis = RESPONSE_TIMEOUT_MILLIS)
+        : m_Socket(socket(AF_INET, SOCK_DGRAM, 0)),
+          m_Path(host + ":" + std::to_string(static_cast<unsigned>(port))),
+          m_ResponseTimeoutMillis(response_timeout_millis)
+    {
+        if (m_Socket < 0)
+            return;
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1 ||
+            connect(m_Socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            ::close(m_Socket);
+            m_Socket = -1;
+        }
+    }
+
+    UdpClient(const UdpClient &) = delete;            // disable copying
+    UdpClient &operator=(const UdpClient &) = delete; // disable assignment
+
+    ~UdpClient()
+    {
+        if (m_Socket >= 0)
+        {
+            ::close(m_Socket);
+        }
+        m_Socket = -1;
+    }
+
+    std::vector<Enumerate> enumerate() const override
+    {
+        std::vector<Enumerate> devices;
+        uint8_t packet[PACKET_SIZE];
+
+        drain();
+        if (m_Socket < 0 || send(m_Socket, "PINGPING", 8, 0) != 8)
+            return devices;
+
+        auto size = receive(packet, PING_TIMEOUT_MILLIS);
+        if (size == 8 && memcmp(packet, "PONGPONG", 8) == 0)
+            devices.push_back({m_Path, SessionHandle(), 0, 0});
+
+        return devices;
+    }
+
+    Session acquire(std::string path, SessionHandle previousSession = SessionHandle()) const override
+    {
+        Session session;
+        if (path != m_Path)
+            session.error = "device not found";
+        else
+            session.session = SessionHandle::number(++m_LastSession);
+        return session;
+    }
+
+    Session release(SessionHandle session) const override
+    {
+        return {session, {}};
+    }
+
+    Call call(SessionHandle session, const std::string &hex) const override
+    {
+        Call response;
+        if (m_Socket < 0)
+        {
+            response.type = INTERNAL_ERROR;
+            response.error = "emulator socket is not connected";
+            return response;
+        }
+
+        std::vector<uint8_t> message(hex.size() / 2);
+        hex2bin(hex.c_str(), hex.size(), message.data());
+
+        drain();
+        if (!write(message))
+        {
+            response.type = INTERNAL_ERROR;
+            response.error = "failed to send message to emulator";
+            return response;
+        }
+
+        std::vector<uint8_t> raw;
+        auto error = read(raw);
+        if (error == nullptr)
+        {
+            response.from_bytes(raw.data());
+        }
+        else
+        {
+            response.type = INTERNAL_ERROR;
+            response.error = error;
+        }
+        return response;
+    }
+
+  private:
+    int m_Socket = -1;
+    std::string m_Path;
+    int m_ResponseTimeoutMillis;
+    mutable std::atomic<unsigned long> m_LastSession{0};
+
+    static constexpr size_t PACKET_SIZE = 64;
+    static constexpr size_t HEADER_SIZE = 6; // BE uint16_t type, BE uint32_t size
+    static constexpr size_t MAX_MESSAGE_SIZE = 1024 * 1024;
+    static constexpr int PING_TIMEOUT_MILLIS = 500;
+    static constexpr int RESPONSE_TIMEOUT_MILLIS = 5 * 60 * 1000;
+    // the packets of one message follow each other right away
+    static constexpr int PACKET_TIMEOUT_MILLIS = 1000;
+
+    // message is type, size and body, the same bytes the bridge gets as hex;
+    // the first packet prefixes them with "?##", following ones with "?"
+    bool write(const std::vector<uint8_t> &message) const
+    {
+        uint8_t packet[PACKET_SIZE];
+        size_t offset = 0;
+        bool first = true;
+
+        do
+        {
+            memset(packet, 0, PACKET_SIZE);
+            size_t magic = first ? 3 : 1;
+            memcpy(packet, "?##", magic);
+
+            size_t chunk = std::min(PACKET_SIZE - magic, message.size() - offset);
+            memcpy(packet + magic, message.data() + offset, chunk);
+            offset += chunk;
+            first = false;
+
+            if (send(m_Socket, packet, PACKET_SIZE, 0) != static_cast<ssize_t>(PACKET_SIZE))
+                return false;
+        } while (offset < message.size());
+
+        return true;
+    }
+
+    // reassembles type, size and body of the next message into raw, returns
+    // the error when it fails
+    const char *read(std::vector<uint8_t> &raw) const
+    {
+        uint8_t packet[PACKET_SIZE];
+
+        auto size = receive(packet, m_ResponseTimeoutMillis);
+        if (size < 0)
+            return "emulator did not respond in time";
+        if (size != static_cast<ssize_t>(PACKET_SIZE) || memcmp(packet, "?##", 3) != 0)
+            return "response is malformed";
+
+        uint32_t length = 0;
+        copy_reversed(packet + 3 + sizeof(uint16_t), &length);
+        if (length > MAX_MESSAGE_SIZE)
+            return "response is too large";
+
+        size_t total = HEADER_SIZE + length;
+        raw.reserve(total);
+        raw.assign(packet + 3, packet + 3 + std::min(total, PACKET_SIZE - 3));
+
+        while (raw.size() < total)
+        {
+            size = receive(packet, PACKET_TIMEOUT_MILLIS);
+            if (size < 0)
+                return "response is truncated";
+            if (size != static_cast<ssize_t>(PACKET_SIZE) || packet[0] != '?')
+                return "response is malformed";
+
+            auto chunk = std::min(total - raw.size(), PACKET_SIZE - 1);
+            raw.insert(raw.end(), packet + 1, packet + 1 + chunk);
+        }
+        return nullptr;
+    }
+
+    ssize_t receive(uint8_t *packet, int timeout_millis) const
+    {
+        pollfd fd = {m_Socket, POLLIN, 0};
+        if (poll(&fd, 1, timeout_millis) <= 0)
+            return -1;
+        return recv(m_Socket, packet, PACKET_SIZE, 0);
+    }
+
+    // drops datagrams left over from an interrupted exchange
+    void drain() const
+    {
+        uint8_t packet[PACKET_SIZE];
+        while (receive(packet, 0) > 0)
+            ;
+    }
+};
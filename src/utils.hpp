@@ -1,11 +1,23 @@
 #pragma once
 
 #include <cstdio>
-#include <iomanip>
-#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
+#include "buffer_pool.hpp"
+#include "hex.hpp"
+#include "message_traits.hpp"
+
+// Built with TREZOR_PROTOBUF_LITE the messages are generated for the lite
+// runtime, which has no descriptors or reflection
+#ifdef TREZOR_PROTOBUF_LITE
+#include <google/protobuf/message_lite.h>
+using ProtobufMessage = google::protobuf::MessageLite;
+#else
 #include <google/protobuf/message.h>
-#include "messages.pb.h"
+using ProtobufMessage = google::protobuf::Message;
+#endif
 
 const uint16_t INTERNAL_ERROR = 999;
 
@@ -30,12 +42,7 @@ struct pair_hash
 
 extern "C" inline void hex2bin(const char *hexString, const size_t sizeString, unsigned char *outBytes)
 {
-    uint32_t buffer = 0;
-    for (size_t i = 0; i < sizeString / 2; i++)
-    {
-        sscanf(hexString + 2 * i, "%2X", &buffer);
-        outBytes[i] = buffer;
-    }
+    hex::decode(hexString, sizeString, outBytes);
 }
 
 template <typename T>
@@ -49,29 +56,58 @@ void copy_reversed(const uint8_t *bytes, T *value)
 template <typename Container>
 std::string pack_message(int type, size_t length, const Container &msg)
 {
-    std::ostringstream ss;
-    // Write message type
-    ss << std::setfill('0') << std::setw(4) << std::hex << type;
-    // Write message length
-    ss << std::setw(8) << std::hex << length;
-    // Write message as a hex string
-    for (size_t i = 0; i < length; i++)
+    const uint8_t header[] = {
+        // Message type
+        static_cast<uint8_t>(type >> 8), static_cast<uint8_t>(type),
+        // Message length
+        static_cast<uint8_t>(length >> 24), static_cast<uint8_t>(length >> 16),
+        static_cast<uint8_t>(length >> 8), static_cast<uint8_t>(length)};
+
+    auto packed = BufferPool::hex().take(2 * (sizeof(header) + length));
+    hex::encode(header, sizeof(header), &packed[0]);
+    // Message as a hex string
+    hex::encode(reinterpret_cast<const uint8_t *>(msg.data()), length, &packed[2 * sizeof(header)]);
+    return packed;
+}
+
+// The body only lives until the next serialize on this thread
+inline const std::vector<uint8_t> &serialize(const google::protobuf::MessageLite &msg)
+{
+    static thread_local std::vector<uint8_t> body;
+    body.resize(msg.ByteSizeLong());
+    msg.SerializeToArray(body.data(), static_cast<int>(body.size()));
+    return body;
+}
+
+template <typename T, typename = typename std::enable_if<message_traits<T>::is_message>::type>
+std::string pack_message(const T &msg)
+{
+    const auto &body = serialize(msg);
+    return pack_message(message_traits<T>::id, body.size(), body);
+}
+
+// -1 when the name is not in the MessageType enum
+inline int message_type_id(const std::string &name)
+{
+    for (const auto &entry : message_types)
     {
-        auto byte = static_cast<uint32_t>(static_cast<uint8_t>(msg[i]));
-        ss << std::setw(2) << std::hex << byte;
+        if (name == entry.name)
+            return entry.id;
     }
-    return ss.str();
+    return -1;
 }
 
-inline std::string pack_message(const google::protobuf::Message &msg)
+// Looks the wire id up at runtime, for messages only known as a base class.
+inline std::string pack_message(const google::protobuf::MessageLite &msg)
 {
-    auto name = "MessageType_" + msg.GetDescriptor()->name();
-    auto msg_type = hw::trezor::messages::MessageType_descriptor()
-                        ->FindValueByName(name)
-                        ->number();
-    auto serialized_msg = msg.SerializeAsString();
+    // the full name, package included
+    auto name = msg.GetTypeName();
+    auto msg_type = message_type_id(name.substr(name.rfind('.') + 1));
+    if (msg_type < 0)
+        throw std::invalid_argument("not a wire message: " + name);
 
-    return pack_message(msg_type, serialized_msg.size(), serialized_msg);
+    const auto &body = serialize(msg);
+    return pack_message(msg_type, body.size(), body);
 }
 
 inline std::string get_message_type_name(int type)
@@ -79,15 +115,8 @@ inline std::string get_message_type_name(int type)
     if (type == INTERNAL_ERROR)
         return "CLIENT INTERNAL ERROR";
 
-    auto name = hw::trezor::messages::MessageType_descriptor()
-                    ->FindValueByNumber(type)
-                    ->name();
-
-    auto prefix = std::string("MessageType_");
-    auto i = name.find(prefix);
-    if (i != std::string::npos)
-        name.erase(i, prefix.length());
-    return name;
+    auto name = message_type_name(type);
+    return name ? name : "UNKNOWN";
 }
 
 template <typename Parrent, typename Child>
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include "buffer_pool.hpp"
+#include "hex.hpp"
+#include "message_pool.hpp"
+#include "message_traits.hpp"
+#include "utils.hpp"
+#include "wire/hds_tx_encoder.hpp"
+#include "messages-management.pb.h"
+
+// Hex frames of requests that serialize to the same bytes every time. Each
+// frame is packed once and then only copied into a pooled buffer, so these
+// requests skip serialization and hex encoding. Frames are byte-identical
+// to what pack_message gives for the same message.
+namespace wire
+{
+
+// the copy is handed back to BufferPool once it is sent
+inline std::string copy_frame(const std::string &frame)
+{
+    auto packed = BufferPool::hex().take(frame.size());
+    std::copy(frame.begin(), frame.end(), &packed[0]);
+    return packed;
+}
+
+// a message with no field set, like ButtonAck, Initialize or GetFeatures
+template <typename Message>
+std::string constant_frame()
+{
+    static const std::string frame = pack_message(Message());
+    return copy_frame(frame);
+}
+
+// a message with a single bool field, one frame for each value
+template <typename Message, uint8_t Field>
+std::string flag_frame(bool value)
+{
+    static const std::string frames[] = {
+        pack<Message>(varint_field_size(0), [](uint8_t *out) { write_varint_field(out, Field, 0); }),
+        pack<Message>(varint_field_size(1), [](uint8_t *out) { write_varint_field(out, Field, 1); })};
+    return copy_frame(frames[value]);
+}
+
+// A message with a single varint field, like the slot of HdsGenerateNonce.
+// A value that fits one byte is patched into the last digits of the frame
+// packed for 0, larger ones change the length and are packed in full.
+template <typename Message, uint8_t Field>
+std::string varint_frame(uint32_t value)
+{
+    if (value >= 0x80)
+    {
+        return pack<Message>(varint_field_size(value),
+                             [value](uint8_t *out) { write_varint_field(out, Field, value); });
+    }
+
+    static const std::string frame =
+        pack<Message>(varint_field_size(0), [](uint8_t *out) { write_varint_field(out, Field, 0); });
+    auto packed = copy_frame(frame);
+    const uint8_t byte = static_cast<uint8_t>(value);
+    hex::encode(&byte, 1, &packed[packed.size() - 2]);
+    return packed;
+}
+
+// Health pings repeat the same text, so the last Ping packed on this thread
+// is kept and reused while its fields stay the same.
+inline std::string ping_frame(const std::string &text, bool button_protection)
+{
+    static thread_local std::string last_text;
+    static thread_local bool last_button_protection = false;
+    static thread_local std::string frame;
+
+    if (frame.empty() || text != last_text || button_protection != last_button_protection)
+    {
+        PooledMessage<hw::trezor::messages::management::Ping> message;
+        message->set_message(text);
+        message->set_button_protection(button_protection);
+
+        frame = pack_message(*message);
+        last_text = text;
+        last_button_protection = button_protection;
+    }
+    return copy_frame(frame);
+}
+
+} // namespace wire
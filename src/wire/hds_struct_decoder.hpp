@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "hw_definitions.hpp"
+#include "message_traits.hpp"
+#include "wire/wire_format.hpp"
+
+// Reads HDS responses straight into the hw_definitions structs, without
+// building the protobuf message. Stricter than the protobuf parser: every
+// bytes field must be exactly 32 bytes long and fields the struct can not
+// do without must be there. Unknown fields are skipped and repeated
+// fields merge the way protobuf merges them.
+namespace wire
+{
+
+inline bool read_point(Reader reader, HdsCrypto_CompactPoint &point, bool &has_x)
+{
+    while (!reader.done())
+    {
+        uint32_t field = 0;
+        uint8_t type = 0;
+        if (!reader.read_tag(field, type))
+            return false;
+
+        bool ok;
+        if (field == 1 && type == LENGTH_DELIMITED)
+            ok = has_x = reader.read_bytes(point.m_X);
+        else if (field == 2 && type == VARINT)
+            ok = reader.read_bool(point.m_Y);
+        else
+            ok = reader.skip(type);
+        if (!ok)
+            return false;
+    }
+    return true;
+}
+
+inline bool read_nested_point(Reader &reader, HdsCrypto_CompactPoint &point, bool &has_x)
+{
+    Reader nested;
+    return reader.read_nested(nested) && read_point(nested, point, has_x);
+}
+
+// Message type -> struct it decodes into
+template <typename Message>
+struct StructDecoder;
+
+template <>
+struct StructDecoder<hw::trezor::messages::hds::HdsECCPoint>
+{
+    using Struct = HdsCrypto_CompactPoint;
+
+    static bool decode(const uint8_t *data, size_t size, Struct &point)
+    {
+        point = Struct();
+        bool has_x = false;
+        return read_point(Reader(data, size), point, has_x) && has_x;
+    }
+};
+
+template <>
+struct StructDecoder<hw::trezor::messages::hds::HdsOwnerKey>
+{
+    using Struct = HdsCrypto_UintBig;
+
+    static bool decode(const uint8_t *data, size_t size, Struct &key)
+    {
+        key = Struct();
+        bool has_key = false;
+        Reader reader(data, size);
+        while (!reader.done())
+        {
+            uint32_t field = 0;
+            uint8_t type = 0;
+            if (!reader.read_tag(field, type))
+                return false;
+
+            bool ok;
+            if (field == 1 && type == LENGTH_DELIMITED)
+                ok = has_key = reader.read_bytes(key);
+            else
+                ok = reader.skip(type);
+            if (!ok)
+                return false;
+        }
+        return has_key;
+    }
+};
+
+template <>
+struct StructDecoder<hw::trezor::messages::hds::HdsPKdf>
+{
+    using Struct = HdsCrypto_KdfPub;
+
+    static bool decode(const uint8_t *data, size_t size, Struct &kdf)
+    {
+        kdf = Struct();
+        bool has_secret = false, has_g = false, has_j = false;
+        Reader reader(data, size);
+        while (!reader.done())
+        {
+            uint32_t field = 0;
+            uint8_t type = 0;
+            if (!reader.read_tag(field, type))
+                return false;
+
+            bool ok;
+            if (field == 1 && type == LENGTH_DELIMITED)
+                ok = has_secret = reader.read_bytes(kdf.m_Secret);
+            else if (field == 2 && type == LENGTH_DELIMITED)
+                ok = read_nested_point(reader, kdf.m_CoFactorG, has_g);
+            else if (field == 3 && type == LENGTH_DELIMITED)
+                ok = read_nested_point(reader, kdf.m_CoFactorJ, has_j);
+            else
+                ok = reader.skip(type);
+            if (!ok)
+                return false;
+        }
+        return has_secret && has_g && has_j;
+    }
+};
+
+// a failed rangeproof may come without its data
+template <>
+struct StructDecoder<hw::trezor::messages::hds::HdsRangeproofData>
+{
+    using Struct = HdsCrypto_RangeproofData;
+
+    static bool decode(const uint8_t *data, size_t size, Struct &rangeproof)
+    {
+        rangeproof = Struct();
+        bool has_taux = false, has_t1 = false, has_t2 = false;
+        Reader reader(data, size);
+        while (!reader.done())
+        {
+            uint32_t field = 0;
+            uint8_t type = 0;
+            if (!reader.read_tag(field, type))
+                return false;
+
+            bool ok;
+            if (field == 1 && type == LENGTH_DELIMITED)
+                ok = has_taux = reader.read_bytes(rangeproof.m_TauX);
+            else if (field == 2 && type == VARINT)
+                ok = reader.read_bool(rangeproof.m_IsSuccessful);
+            else if (field == 3 && type == LENGTH_DELIMITED)
+                ok = read_nested_point(reader, rangeproof.m_T1, has_t1);
+            else if (field == 4 && type == LENGTH_DELIMITED)
+                ok = read_nested_point(reader, rangeproof.m_T2, has_t2);
+            else
+                ok = reader.skip(type);
+            if (!ok)
+                return false;
+        }
+        return !rangeproof.m_IsSuccessful || (has_taux && has_t1 && has_t2);
+    }
+};
+
+} // namespace wire
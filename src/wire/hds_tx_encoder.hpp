@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "hw_definitions.hpp"
+#include "message_traits.hpp"
+#include "utils.hpp"
+#include "wire/wire_format.hpp"
+
+// Writes the HdsSignTransaction* requests straight from the hw_definitions
+// structs in protobuf wire format, without building the message objects.
+// The output is byte-identical to what SerializeAsString gives for the
+// messages DeviceManager used to build: every field is set, and fields are
+// written in field number order like protoc-generated code does.
+namespace wire
+{
+
+inline size_t varint_field_size(uint64_t value)
+{
+    return 1 + varint_size(value);
+}
+
+inline uint8_t *write_varint_field(uint8_t *out, uint8_t field, uint64_t value)
+{
+    return write_varint(write_tag(out, field, VARINT), value);
+}
+
+inline size_t nested_field_size(size_t size)
+{
+    return 1 + varint_size(size) + size;
+}
+
+// the caller writes the size bytes after it
+inline uint8_t *write_nested_header(uint8_t *out, uint8_t field, size_t size)
+{
+    return write_varint(write_tag(out, field, LENGTH_DELIMITED), size);
+}
+
+inline uint8_t *write_bytes_field(uint8_t *out, uint8_t field, const HdsCrypto_UintBig &value)
+{
+    out = write_nested_header(out, field, sizeof(value.m_pVal));
+    std::copy(value.m_pVal, value.m_pVal + sizeof(value.m_pVal), out);
+    return out + sizeof(value.m_pVal);
+}
+
+// HdsCoinID
+
+inline size_t coin_id_size(const HdsCrypto_CoinID &cid)
+{
+    return varint_field_size(cid.m_Idx) + varint_field_size(cid.m_Type) + varint_field_size(cid.m_SubIdx) +
+           varint_field_size(cid.m_Amount) + varint_field_size(cid.m_AssetID);
+}
+
+inline uint8_t *write_coin_id(uint8_t *out, const HdsCrypto_CoinID &cid)
+{
+    out = write_varint_field(out, 1, cid.m_Idx);
+    out = write_varint_field(out, 2, cid.m_Type);
+    out = write_varint_field(out, 3, cid.m_SubIdx);
+    out = write_varint_field(out, 4, cid.m_Amount);
+    return write_varint_field(out, 5, cid.m_AssetID);
+}
+
+// HdsECCPoint
+
+inline size_t point_size(const HdsCrypto_CompactPoint &)
+{
+    return nested_field_size(sizeof(HdsCrypto_UintBig)) + varint_field_size(1);
+}
+
+inline uint8_t *write_point(uint8_t *out, const HdsCrypto_CompactPoint &point)
+{
+    out = write_bytes_field(out, 1, point.m_X);
+    return write_varint_field(out, 2, point.m_Y != 0);
+}
+
+// HdsSignature
+
+inline size_t signature_size(const HdsCrypto_Signature &signature)
+{
+    return nested_field_size(point_size(signature.m_NoncePub)) + nested_field_size(sizeof(HdsCrypto_UintBig));
+}
+
+inline uint8_t *write_signature(uint8_t *out, const HdsCrypto_Signature &signature)
+{
+    out = write_nested_header(out, 1, point_size(signature.m_NoncePub));
+    out = write_point(out, signature.m_NoncePub);
+    return write_bytes_field(out, 2, signature.m_k);
+}
+
+// HdsTxCommon.HdsKernelParameters
+
+inline size_t kernel_size(const HdsCrypto_TxKernel &kernel)
+{
+    return varint_field_size(kernel.m_Fee) + varint_field_size(kernel.m_hMin) + varint_field_size(kernel.m_hMax) +
+           nested_field_size(point_size(kernel.m_Commitment)) + nested_field_size(signature_size(kernel.m_Signature));
+}
+
+inline uint8_t *write_kernel(uint8_t *out, const HdsCrypto_TxKernel &kernel)
+{
+    out = write_varint_field(out, 1, kernel.m_Fee);
+    out = write_varint_field(out, 2, kernel.m_hMin);
+    out = write_varint_field(out, 3, kernel.m_hMax);
+    out = write_nested_header(out, 4, point_size(kernel.m_Commitment));
+    out = write_point(out, kernel.m_Commitment);
+    out = write_nested_header(out, 5, signature_size(kernel.m_Signature));
+    return write_signature(out, kernel.m_Signature);
+}
+
+// HdsTxCommon
+
+inline size_t coin_ids_size(const std::vector<HdsCrypto_CoinID> &cids)
+{
+    size_t size = 0;
+    for (const auto &cid : cids)
+        size += nested_field_size(coin_id_size(cid));
+    return size;
+}
+
+inline uint8_t *write_coin_ids(uint8_t *out, uint8_t field, const std::vector<HdsCrypto_CoinID> &cids)
+{
+    for (const auto &cid : cids)
+    {
+        out = write_nested_header(out, field, coin_id_size(cid));
+        out = write_coin_id(out, cid);
+    }
+    return out;
+}
+
+inline size_t tx_common_size(const HdsCrypto_TxCommon &tx)
+{
+    return coin_ids_size(*tx.m_pIns) + nested_field_size(sizeof(HdsCrypto_UintBig)) + coin_ids_size(*tx.m_pOuts) +
+           nested_field_size(kernel_size(tx.m_Krn));
+}
+
+inline uint8_t *write_tx_common(uint8_t *out, const HdsCrypto_TxCommon &tx)
+{
+    out = write_coin_ids(out, 1, *tx.m_pIns);
+    out = write_bytes_field(out, 2, tx.m_kOffset);
+    out = write_coin_ids(out, 3, *tx.m_pOuts);
+    out = write_nested_header(out, 4, kernel_size(tx.m_Krn));
+    return write_kernel(out, tx.m_Krn);
+}
+
+// HdsTxMutualInfo
+
+inline size_t mutual_info_size(const HdsCrypto_TxMutualInfo &info)
+{
+    return nested_field_size(sizeof(HdsCrypto_UintBig)) + varint_field_size(info.m_MyIDKey) +
+           nested_field_size(signature_size(info.m_PaymentProofSignature));
+}
+
+inline uint8_t *write_mutual_info(uint8_t *out, const HdsCrypto_TxMutualInfo &info)
+{
+    out = write_bytes_field(out, 1, info.m_Peer);
+    out = write_varint_field(out, 2, info.m_MyIDKey);
+    out = write_nested_header(out, 3, signature_size(info.m_PaymentProofSignature));
+    return write_signature(out, info.m_PaymentProofSignature);
+}
+
+// Encodes into a per-thread buffer that only grows, then packs it into the
+// bridge hex frame
+template <typename Message, typename Write>
+std::string pack(size_t size, Write write)
+{
+    static thread_local std::vector<uint8_t> buffer;
+    if (buffer.size() < size)
+        buffer.resize(size);
+
+    write(buffer.data());
+    return pack_message(message_traits<Message>::id, size, buffer);
+}
+
+inline std::string pack_sign_transaction_send(const HdsCrypto_TxCommon &tx, const HdsCrypto_TxMutualInfo &info,
+                                              const HdsCrypto_TxSenderParams &sender)
+{
+    auto common_size = tx_common_size(tx);
+    auto info_size = mutual_info_size(info);
+    auto size = nested_field_size(common_size) + nested_field_size(info_size) + varint_field_size(sender.m_iSlot) +
+                nested_field_size(sizeof(HdsCrypto_UintBig));
+
+    return pack<hw::trezor::messages::hds::HdsSignTransactionSend>(size, [&](uint8_t *out) {
+        out = write_nested_header(out, 1, common_size);
+        out = write_tx_common(out, tx);
+        out = write_nested_header(out, 2, info_size);
+        out = write_mutual_info(out, info);
+        out = write_varint_field(out, 3, sender.m_iSlot);
+        write_bytes_field(out, 4, sender.m_UserAgreement);
+    });
+}
+
+inline std::string pack_sign_transaction_receive(const HdsCrypto_TxCommon &tx, const HdsCrypto_TxMutualInfo &info)
+{
+    auto common_size = tx_common_size(tx);
+    auto info_size = mutual_info_size(info);
+    auto size = nested_field_size(common_size) + nested_field_size(info_size);
+
+    return pack<hw::trezor::messages::hds::HdsSignTransactionReceive>(size, [&](uint8_t *out) {
+        out = write_nested_header(out, 1, common_size);
+        out = write_tx_common(out, tx);
+        out = write_nested_header(out, 2, info_size);
+        write_mutual_info(out, info);
+    });
+}
+
+inline std::string pack_sign_transaction_split(const HdsCrypto_TxCommon &tx)
+{
+    auto common_size = tx_common_size(tx);
+
+    return pack<hw::trezor::messages::hds::HdsSignTransactionSplit>(nested_field_size(common_size), [&](uint8_t *out) {
+        out = write_nested_header(out, 1, common_size);
+        write_tx_common(out, tx);
+    });
+}
+
+} // namespace wire
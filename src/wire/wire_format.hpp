@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "hw_definitions.hpp"
+
+// Protobuf wire format primitives shared by the hand-written encoders and
+// decoders of the hot HDS messages.
+namespace wire
+{
+
+enum WireType : uint8_t
+{
+    VARINT = 0,
+    FIXED64 = 1,
+    LENGTH_DELIMITED = 2,
+    FIXED32 = 5
+};
+
+// a varint never takes more bytes than this
+static const size_t MAX_VARINT_SIZE = 10;
+
+inline size_t varint_size(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+inline uint8_t *write_varint(uint8_t *out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *out++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+
+// field numbers here are below 16, so every tag is one byte
+inline uint8_t *write_tag(uint8_t *out, uint8_t field, WireType type)
+{
+    *out++ = static_cast<uint8_t>(field << 3 | type);
+    return out;
+}
+
+// Reads fields off a buffer it does not own. Every read checks the bounds
+// and returns false on malformed input.
+class Reader
+{
+  public:
+    Reader() = default;
+
+    Reader(const uint8_t *data, size_t size) : m_data(data), m_end(data + size)
+    {
+    }
+
+    bool done() const
+    {
+        return m_data == m_end;
+    }
+
+    bool read_varint(uint64_t &value)
+    {
+        value = 0;
+        for (size_t i = 0; i < MAX_VARINT_SIZE && m_data != m_end; i++)
+        {
+            uint8_t byte = *m_data++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << (7 * i);
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    bool read_tag(uint32_t &field, uint8_t &type)
+    {
+        uint64_t tag = 0;
+        if (!read_varint(tag) || tag > UINT32_MAX)
+            return false;
+
+        field = static_cast<uint32_t>(tag >> 3);
+        type = static_cast<uint8_t>(tag & 7);
+        return field != 0;
+    }
+
+    // the payload of a length-delimited field
+    bool read_nested(Reader &nested)
+    {
+        uint64_t size = 0;
+        if (!read_varint(size) || size > static_cast<uint64_t>(m_end - m_data))
+            return false;
+
+        nested = Reader(m_data, static_cast<size_t>(size));
+        m_data += size;
+        return true;
+    }
+
+    // bytes fields of the HDS messages are exactly this long
+    bool read_bytes(HdsCrypto_UintBig &value)
+    {
+        Reader nested;
+        if (!read_nested(nested) || nested.m_end - nested.m_data != sizeof(value.m_pVal))
+            return false;
+
+        std::copy(nested.m_data, nested.m_end, value.m_pVal);
+        return true;
+    }
+
+    bool read_bool(uint8_t &value)
+    {
+        uint64_t raw = 0;
+        if (!read_varint(raw))
+            return false;
+
+        value = raw != 0;
+        return true;
+    }
+
+    // groups are deprecated and never sent by the device, they are rejected
+    bool skip(uint8_t type)
+    {
+        uint64_t value = 0;
+        Reader nested;
+        switch (type)
+        {
+        case VARINT:
+            return read_varint(value);
+        case FIXED64:
+            return advance(8);
+        case LENGTH_DELIMITED:
+            return read_nested(nested);
+        case FIXED32:
+            return advance(4);
+        default:
+            return false;
+        }
+    }
+
+  private:
+    bool advance(size_t size)
+    {
+        if (size > static_cast<size_t>(m_end - m_data))
+            return false;
+
+        m_data += size;
+        return true;
+    }
+
+    const uint8_t *m_data = nullptr;
+    const uint8_t *m_end = nullptr;
+};
+
+} // namespace wire
@@ -0,0 +1,277 @@
+// Drives DeviceManager through a fake Transport and checks that every call
+// ends exactly once: with its response, or with a Failure for the calls the
+// transport or the bridge refused.
+//
+//   device_manager_test
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "device_manager.hpp"
+
+namespace
+{
+
+const auto TIMEOUT = std::chrono::seconds(5);
+
+// answers every call with respond, on the manager's worker thread
+class FakeTransport : public Transport
+{
+  public:
+    using Respond = std::function<Call(const std::string &)>;
+
+    explicit FakeTransport(Respond respond, std::atomic<int> *releases = nullptr)
+        : m_respond(std::move(respond)), m_releases(releases)
+    {
+    }
+
+    std::vector<Enumerate> enumerate() const override
+    {
+        return {};
+    }
+
+    Session acquire(std::string, SessionHandle) const override
+    {
+        Session session;
+        session.session = SessionHandle::from_string("1");
+        return session;
+    }
+
+    // the bridge answers with the released session
+    Session release(SessionHandle handle) const override
+    {
+        if (m_releases)
+            (*m_releases)++;
+        Session session;
+        session.session = handle;
+        return session;
+    }
+
+    Call call(SessionHandle, const std::string &hex) const override
+    {
+        return m_respond(hex);
+    }
+
+  private:
+    Respond m_respond;
+    std::atomic<int> *m_releases;
+};
+
+std::unique_ptr<DeviceManager> make_manager(FakeTransport::Respond respond, std::atomic<int> *releases = nullptr)
+{
+    std::unique_ptr<DeviceManager> manager(
+        new DeviceManager(std::unique_ptr<Transport>(new FakeTransport(std::move(respond), releases))));
+    Enumerate enumerate;
+    enumerate.path = "fake";
+    enumerate.session = SessionHandle();
+    enumerate.vendor = 0;
+    enumerate.product = 0;
+    manager->init(enumerate);
+    return manager;
+}
+
+// the bridge answers {"error": ...}, CallDecoder turns it into a Call
+Call bridge_error(const std::string &error)
+{
+    CallDecoder decoder;
+    auto json = "{\"error\":\"" + error + "\"}";
+    decoder.append(json.data(), json.size());
+    return decoder.finish();
+}
+
+int failures = 0;
+
+void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// the future fails with the bridge's error, the callback form reaches the
+// global Failure handler, and nothing reaches the other handlers
+void check_bridge_error()
+{
+    auto manager = make_manager([](const std::string &) { return bridge_error("device disconnected"); });
+
+    std::promise<std::string> global;
+    std::atomic<int> global_calls{0};
+    std::atomic<int> other_calls{0};
+    manager->on<Failure>([&](const Failure &failure, SessionHandle, size_t) {
+        if (global_calls++ == 0)
+            global.set_value(failure.message());
+    });
+    manager->on<Success>([&](const Success &, SessionHandle, size_t) { other_calls++; });
+    manager->on<Features>([&](const Features &, SessionHandle, size_t) { other_calls++; });
+
+    auto future = manager->call_Ping("future", false);
+    std::string message;
+    try
+    {
+        expect(future.wait_for(TIMEOUT) == std::future_status::ready, "bridge error: future is not ready");
+        future.get();
+        expect(false, "bridge error: future holds a response");
+    }
+    catch (const DeviceFailure &failure)
+    {
+        message = failure.what();
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "bridge error: future threw " << e.what() << std::endl;
+    }
+    expect(message == "device disconnected", "bridge error: future does not hold the DeviceFailure");
+
+    manager->call_Ping("callback", false, [&](const Success &, SessionHandle, size_t) { other_calls++; });
+    auto reported = global.get_future();
+    expect(reported.wait_for(TIMEOUT) == std::future_status::ready && reported.get() == "device disconnected",
+           "bridge error: callback form is not failed through the global handler");
+
+    manager.reset();
+    expect(global_calls == 1, "bridge error: global handler is not called exactly once");
+    expect(other_calls == 0, "bridge error: a response handler is called");
+}
+
+// What a future ended with: the response, DeviceFailure or neither
+enum class Outcome
+{
+    Response,
+    Failure,
+    Missing
+};
+
+Outcome outcome(std::future<Success> &future)
+{
+    if (future.wait_for(TIMEOUT) != std::future_status::ready)
+        return Outcome::Missing;
+    try
+    {
+        future.get();
+        return Outcome::Response;
+    }
+    catch (const DeviceFailure &)
+    {
+        return Outcome::Failure;
+    }
+    catch (const std::exception &)
+    {
+        return Outcome::Missing;
+    }
+}
+
+// Calls end with a transport error while others are queued and more are
+// being pushed from several threads. Every call ends exactly once, and none
+// that is failed reaches the device.
+void check_transport_error()
+{
+    const size_t ROUNDS = 10;
+    const size_t PUSHERS = 4;
+    const size_t PUSHES = 100;
+
+    std::mutex mutex;
+    std::set<std::string> failing;
+    std::set<std::string> sent;
+    for (size_t round = 0; round < ROUNDS; round++)
+        failing.insert(wire::ping_frame("fail " + std::to_string(round), false));
+
+    auto manager = make_manager([&](const std::string &hex) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (failing.count(hex) != 0)
+        {
+            Call call;
+            call.type = INTERNAL_ERROR;
+            call.error = "bridge is gone";
+            return call;
+        }
+
+        sent.insert(hex);
+        Success success;
+        return make_call(success);
+    });
+
+    std::vector<std::future<Success>> failed_first;
+    std::vector<std::string> texts;
+    std::vector<std::future<Success>> futures;
+    for (size_t round = 0; round < ROUNDS; round++)
+    {
+        failed_first.push_back(manager->call_Ping("fail " + std::to_string(round), false));
+
+        std::vector<std::thread> pushers;
+        std::vector<std::vector<std::string>> pushed_texts(PUSHERS);
+        std::vector<std::vector<std::future<Success>>> pushed_futures(PUSHERS);
+        for (size_t pusher = 0; pusher < PUSHERS; pusher++)
+        {
+            pushers.emplace_back([&, round, pusher] {
+                for (size_t i = 0; i < PUSHES; i++)
+                {
+                    auto text = std::to_string(round) + " " + std::to_string(pusher) + " " + std::to_string(i);
+                    pushed_futures[pusher].push_back(manager->call_Ping(text, false));
+                    pushed_texts[pusher].push_back(std::move(text));
+                }
+            });
+        }
+        for (size_t pusher = 0; pusher < PUSHERS; pusher++)
+        {
+            pushers[pusher].join();
+            texts.insert(texts.end(), pushed_texts[pusher].begin(), pushed_texts[pusher].end());
+            for (auto &future : pushed_futures[pusher])
+                futures.push_back(std::move(future));
+        }
+    }
+
+    for (auto &future : failed_first)
+        expect(outcome(future) == Outcome::Failure, "transport error: the call in flight is not failed");
+    int missing = 0;
+    int mismatched = 0;
+    for (size_t i = 0; i < futures.size(); i++)
+    {
+        auto result = outcome(futures[i]);
+        auto frame = wire::ping_frame(texts[i], false);
+        std::unique_lock<std::mutex> lock(mutex);
+        if (result == Outcome::Missing)
+            missing++;
+        else if ((sent.count(frame) != 0) != (result == Outcome::Response))
+            mismatched++;
+    }
+    expect(missing == 0, "transport error: a call never ended");
+    expect(mismatched == 0, "transport error: a failed call was sent, or a sent call was failed");
+    manager.reset();
+}
+
+// a leased session is released when the manager goes away without close()
+void check_lease_released()
+{
+    std::atomic<int> releases{0};
+    auto manager = make_manager([](const std::string &) { return make_call(Success()); }, &releases);
+    manager->enable_session_lease(std::chrono::minutes(1));
+
+    auto future = manager->call_Ping("leased", false);
+    expect(outcome(future) == Outcome::Response, "lease: the call is not answered");
+    expect(releases == 0, "lease: the session is released while leased");
+
+    manager.reset();
+    expect(releases == 1, "lease: the session is not released on destruction");
+}
+
+} // namespace
+
+int main()
+{
+    check_bridge_error();
+    check_transport_error();
+    check_lease_released();
+
+    std::cout << (failures == 0 ? "ok" : "FAILED") << ": " << failures << " failed checks" << std::endl;
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
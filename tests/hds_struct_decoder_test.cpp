@@ -0,0 +1,233 @@
+// Differential test of wire/hds_struct_decoder.hpp against ParseFromString.
+// Random responses, half of them corrupted, go through both parsers:
+//  - what protobuf rejects, the decoder rejects too
+//  - what the decoder accepts, protobuf accepts with the same values, and
+//    it has every field the struct needs
+//  - an uncorrupted message with every field its struct needs, at the
+//    right length, is accepted
+// The decoder may still reject corrupted inputs protobuf takes, e.g. a
+// wrong-length field repeated before a good one, or an unknown group.
+//
+//   hds_struct_decoder_test [iterations] [seed]
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include "messages-hds.pb.h"
+#include "wire/hds_struct_decoder.hpp"
+
+using namespace hw::trezor::messages::hds;
+
+namespace
+{
+
+std::mt19937_64 rng;
+
+bool one_in(unsigned n)
+{
+    return rng() % n == 0;
+}
+
+// mostly the 32 bytes the device sends
+std::string random_bytes()
+{
+    std::string bytes(one_in(8) ? rng() % 40 : 32, '\0');
+    for (auto &byte : bytes)
+        byte = static_cast<char>(rng());
+    return bytes;
+}
+
+void randomize(HdsECCPoint *point)
+{
+    if (!one_in(10))
+        point->set_x(random_bytes());
+    if (one_in(2))
+        point->set_y(one_in(2));
+}
+
+// a flipped bit, a truncation or an unknown field appended
+std::string corrupt(std::string wire)
+{
+    switch (rng() % 3)
+    {
+    case 0:
+        if (!wire.empty())
+            wire[rng() % wire.size()] ^= static_cast<char>(1 << rng() % 8);
+        break;
+    case 1:
+        if (!wire.empty())
+            wire.resize(rng() % wire.size());
+        break;
+    default:
+        auto field = 5 + rng() % 10;
+        auto size = rng() % 5;
+        wire.push_back(static_cast<char>(field << 3 | (one_in(2) ? wire::VARINT : wire::LENGTH_DELIMITED)));
+        wire.push_back(static_cast<char>(size));
+        wire.append(size, 'x');
+        break;
+    }
+    return wire;
+}
+
+bool is_bytes(const std::string &bytes)
+{
+    return bytes.size() == sizeof(HdsCrypto_UintBig::m_pVal);
+}
+
+// a field the device left out decodes as zeros
+bool same(bool present, const std::string &bytes, const HdsCrypto_UintBig &value)
+{
+    static const HdsCrypto_UintBig zero = {};
+    return present ? is_bytes(bytes) && memcmp(bytes.data(), value.m_pVal, bytes.size()) == 0
+                   : memcmp(zero.m_pVal, value.m_pVal, sizeof(zero.m_pVal)) == 0;
+}
+
+bool same(const HdsECCPoint &point, const HdsCrypto_CompactPoint &value)
+{
+    return same(point.has_x(), point.x(), value.m_X) && point.y() == (value.m_Y != 0);
+}
+
+// a point the decoder accepts where the struct needs one
+bool is_point(const HdsECCPoint &point)
+{
+    return point.has_x() && is_bytes(point.x());
+}
+
+// a point the decoder accepts where the struct can do without one
+bool is_optional_point(bool present, const HdsECCPoint &point)
+{
+    return !present || !point.has_x() || is_bytes(point.x());
+}
+
+struct Results
+{
+    size_t checked = 0;
+    size_t failures = 0;
+};
+
+// half of the inputs are corrupted
+template <typename Message, typename Same, typename Complete>
+void check(const char *name, const Message &source, Same same_values, Complete complete, Results &results)
+{
+    auto wire = source.SerializeAsString();
+    auto corrupted = one_in(2);
+    if (corrupted)
+        wire = corrupt(wire);
+
+    typename wire::StructDecoder<Message>::Struct value;
+    Message message;
+    auto decoded = wire::StructDecoder<Message>::decode(reinterpret_cast<const uint8_t *>(wire.data()), wire.size(), value);
+    auto parsed = message.ParseFromString(wire);
+
+    const char *failure = nullptr;
+    if (decoded && !parsed)
+        failure = "accepted what protobuf rejects";
+    else if (decoded && !same_values(message, value))
+        failure = "decoded other values than protobuf";
+    else if (decoded && !complete(message))
+        failure = "accepted an incomplete message";
+    else if (!decoded && !corrupted && complete(source))
+        failure = "rejected a complete message";
+
+    results.checked++;
+    if (failure == nullptr)
+        return;
+
+    results.failures++;
+    std::cerr << name << ": " << failure << ", input ";
+    for (auto byte : wire)
+        std::cerr << "0123456789abcdef"[static_cast<uint8_t>(byte) >> 4] << "0123456789abcdef"[byte & 0x0f];
+    std::cerr << std::endl;
+}
+
+void check_point(Results &results)
+{
+    HdsECCPoint message;
+    randomize(&message);
+    check<HdsECCPoint>("HdsECCPoint", message, [](const HdsECCPoint &m, const HdsCrypto_CompactPoint &v) { return same(m, v); },
+                       is_point, results);
+}
+
+void check_owner_key(Results &results)
+{
+    HdsOwnerKey message;
+    if (!one_in(10))
+        message.set_key(random_bytes());
+    check<HdsOwnerKey>(
+        "HdsOwnerKey", message,
+        [](const HdsOwnerKey &m, const HdsCrypto_UintBig &v) { return same(m.has_key(), m.key(), v); },
+        [](const HdsOwnerKey &m) { return m.has_key() && is_bytes(m.key()); }, results);
+}
+
+void check_kdf(Results &results)
+{
+    HdsPKdf message;
+    if (!one_in(10))
+        message.set_key(random_bytes());
+    if (!one_in(10))
+        randomize(message.mutable_cofactor_g());
+    if (!one_in(10))
+        randomize(message.mutable_cofactor_j());
+    check<HdsPKdf>(
+        "HdsPKdf", message,
+        [](const HdsPKdf &m, const HdsCrypto_KdfPub &v) {
+            return same(m.has_key(), m.key(), v.m_Secret) && same(m.cofactor_g(), v.m_CoFactorG) &&
+                   same(m.cofactor_j(), v.m_CoFactorJ);
+        },
+        [](const HdsPKdf &m) {
+            return m.has_key() && is_bytes(m.key()) && m.has_cofactor_g() && is_point(m.cofactor_g()) && m.has_cofactor_j() &&
+                   is_point(m.cofactor_j());
+        },
+        results);
+}
+
+void check_rangeproof(Results &results)
+{
+    HdsRangeproofData message;
+    if (!one_in(10))
+        message.set_data_taux(random_bytes());
+    message.set_is_successful(!one_in(3));
+    if (!one_in(10))
+        randomize(message.mutable_pt0());
+    if (!one_in(10))
+        randomize(message.mutable_pt1());
+    check<HdsRangeproofData>(
+        "HdsRangeproofData", message,
+        [](const HdsRangeproofData &m, const HdsCrypto_RangeproofData &v) {
+            return m.is_successful() == (v.m_IsSuccessful != 0) && same(m.has_data_taux(), m.data_taux(), v.m_TauX) &&
+                   same(m.pt0(), v.m_T1) && same(m.pt1(), v.m_T2);
+        },
+        // a failed rangeproof needs none of its data
+        [](const HdsRangeproofData &m) {
+            if (m.is_successful())
+                return m.has_data_taux() && is_bytes(m.data_taux()) && m.has_pt0() && is_point(m.pt0()) && m.has_pt1() &&
+                       is_point(m.pt1());
+            return (!m.has_data_taux() || is_bytes(m.data_taux())) && is_optional_point(m.has_pt0(), m.pt0()) &&
+                   is_optional_point(m.has_pt1(), m.pt1());
+        },
+        results);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    auto iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000;
+    auto seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+    rng.seed(seed);
+
+    Results results;
+    for (unsigned long i = 0; i < iterations && results.failures < 10; i++)
+    {
+        check_point(results);
+        check_owner_key(results);
+        check_kdf(results);
+        check_rangeproof(results);
+    }
+
+    std::cout << (results.failures == 0 ? "ok" : "FAILED") << ": " << results.checked << " responses, " << results.failures
+              << " disagreements, seed " << seed << std::endl;
+    return results.failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,175 @@
+// Differential test of wire/hds_tx_encoder.hpp: random HdsSignTransaction*
+// requests are packed by the hand-written encoder and, from the same
+// structs, through the protobuf messages. The frames must be identical.
+//
+//   hds_tx_encoder_test [iterations] [seed]
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "messages-hds.pb.h"
+#include "wire/hds_tx_encoder.hpp"
+
+using namespace hw::trezor::messages::hds;
+
+namespace
+{
+
+std::mt19937_64 rng;
+
+// varints of every length, small values most often
+uint64_t random_value()
+{
+    auto bits = rng() % 65;
+    return bits == 64 ? rng() : rng() & ((uint64_t(1) << bits) - 1);
+}
+
+void randomize(HdsCrypto_UintBig &value)
+{
+    for (auto &byte : value.m_pVal)
+        byte = static_cast<uint8_t>(rng());
+}
+
+// any non-zero m_Y is sent as true
+void randomize(HdsCrypto_CompactPoint &point)
+{
+    randomize(point.m_X);
+    point.m_Y = static_cast<uint8_t>(rng() % 3);
+}
+
+void randomize(HdsCrypto_Signature &signature)
+{
+    randomize(signature.m_NoncePub);
+    randomize(signature.m_k);
+}
+
+void randomize(HdsCrypto_CoinID &cid)
+{
+    cid.m_Idx = random_value();
+    cid.m_Type = static_cast<uint32_t>(random_value());
+    cid.m_SubIdx = static_cast<uint32_t>(random_value());
+    cid.m_Amount = random_value();
+    cid.m_AssetID = static_cast<uint32_t>(random_value());
+}
+
+void fill(HdsECCPoint *point, const HdsCrypto_CompactPoint &value)
+{
+    point->set_x(value.m_X.m_pVal, sizeof(value.m_X.m_pVal));
+    point->set_y(value.m_Y);
+}
+
+void fill(HdsSignature *signature, const HdsCrypto_Signature &value)
+{
+    fill(signature->mutable_nonce_pub(), value.m_NoncePub);
+    signature->set_sign_k(value.m_k.m_pVal, sizeof(value.m_k.m_pVal));
+}
+
+void fill(HdsCoinID *cid, const HdsCrypto_CoinID &value)
+{
+    cid->set_idx(value.m_Idx);
+    cid->set_type(value.m_Type);
+    cid->set_sub_idx(value.m_SubIdx);
+    cid->set_amount(value.m_Amount);
+    cid->set_asset_id(value.m_AssetID);
+}
+
+void fill(HdsTxCommon *tx, const HdsCrypto_TxCommon &value)
+{
+    for (const auto &cid : *value.m_pIns)
+        fill(tx->add_inputs(), cid);
+    tx->set_offset_sk(value.m_kOffset.m_pVal, sizeof(value.m_kOffset.m_pVal));
+    for (const auto &cid : *value.m_pOuts)
+        fill(tx->add_outputs(), cid);
+
+    auto kernel = tx->mutable_kernel_params();
+    kernel->set_fee(value.m_Krn.m_Fee);
+    kernel->set_min_height(value.m_Krn.m_hMin);
+    kernel->set_max_height(value.m_Krn.m_hMax);
+    fill(kernel->mutable_commitment(), value.m_Krn.m_Commitment);
+    fill(kernel->mutable_signature(), value.m_Krn.m_Signature);
+}
+
+void fill(HdsTxMutualInfo *info, const HdsCrypto_TxMutualInfo &value)
+{
+    info->set_peer(value.m_Peer.m_pVal, sizeof(value.m_Peer.m_pVal));
+    info->set_wallet_identity_key(value.m_MyIDKey);
+    fill(info->mutable_payment_proof_signature(), value.m_PaymentProofSignature);
+}
+
+bool expect_same(const char *name, const std::string &expected, const std::string &packed)
+{
+    if (expected == packed)
+        return true;
+
+    std::cerr << name << " differs" << std::endl
+              << "  protobuf: " << expected << std::endl
+              << "  encoder:  " << packed << std::endl;
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    auto iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    auto seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+    rng.seed(seed);
+
+    size_t failures = 0;
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        // now and then a transaction with hundreds of inputs
+        std::vector<HdsCrypto_CoinID> inputs(rng() % (i % 50 == 0 ? 300 : 6));
+        std::vector<HdsCrypto_CoinID> outputs(rng() % 6);
+        for (auto &cid : inputs)
+            randomize(cid);
+        for (auto &cid : outputs)
+            randomize(cid);
+
+        HdsCrypto_TxCommon tx = {};
+        tx.m_pIns = &inputs;
+        tx.m_pOuts = &outputs;
+        randomize(tx.m_kOffset);
+        tx.m_Krn.m_Fee = random_value();
+        tx.m_Krn.m_hMin = random_value();
+        tx.m_Krn.m_hMax = random_value();
+        randomize(tx.m_Krn.m_Commitment);
+        randomize(tx.m_Krn.m_Signature);
+
+        HdsCrypto_TxMutualInfo info = {};
+        randomize(info.m_Peer);
+        info.m_MyIDKey = random_value();
+        randomize(info.m_PaymentProofSignature);
+
+        HdsCrypto_TxSenderParams sender = {};
+        sender.m_iSlot = static_cast<uint32_t>(random_value());
+        randomize(sender.m_UserAgreement);
+
+        HdsSignTransactionSend send;
+        fill(send.mutable_tx_common(), tx);
+        fill(send.mutable_tx_mutual_info(), info);
+        send.set_nonce_slot(sender.m_iSlot);
+        send.set_user_agreement(sender.m_UserAgreement.m_pVal, sizeof(sender.m_UserAgreement.m_pVal));
+
+        HdsSignTransactionReceive receive;
+        fill(receive.mutable_tx_common(), tx);
+        fill(receive.mutable_tx_mutual_info(), info);
+
+        HdsSignTransactionSplit split;
+        fill(split.mutable_tx_common(), tx);
+
+        if (!expect_same("HdsSignTransactionSend", pack_message(send), wire::pack_sign_transaction_send(tx, info, sender)) ||
+            !expect_same("HdsSignTransactionReceive", pack_message(receive), wire::pack_sign_transaction_receive(tx, info)) ||
+            !expect_same("HdsSignTransactionSplit", pack_message(split), wire::pack_sign_transaction_split(tx)))
+        {
+            std::cerr << "  iteration " << i << ", seed " << seed << std::endl;
+            if (++failures == 10)
+                break;
+        }
+    }
+
+    std::cout << (failures == 0 ? "ok" : "FAILED") << ": " << iterations << " transactions, " << failures << " mismatches"
+              << std::endl;
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}